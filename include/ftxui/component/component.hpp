@@ -20,6 +20,7 @@ struct Event;
 struct InputOption;
 struct MenuOption;
 struct RadioboxOption;
+struct VirtualListOption;
 struct MenuEntryOption;
 
 template <class T, class... Args>
@@ -72,6 +73,8 @@ Component Radiobox(ConstStringListRef entries,
                    int* selected_,
                    RadioboxOption options = {});
 
+Component VirtualList(VirtualListOption options);
+
 Component Dropdown(ConstStringListRef entries, int* selected);
 Component Dropdown(DropdownOption options);
 
@@ -4,8 +4,9 @@
 #ifndef FTXUI_COMPONENT_BASE_HPP
 #define FTXUI_COMPONENT_BASE_HPP
 
-#include <memory>  // for unique_ptr
-#include <vector>  // for vector
+#include <cstdint>  // for uint64_t
+#include <memory>   // for unique_ptr
+#include <vector>   // for vector
 
 #include "ftxui/component/captured_mouse.hpp"  // for CaptureMouse
 #include "ftxui/dom/elements.hpp"              // for Element
@@ -90,14 +91,40 @@ class ComponentBase {
   // Configure all the ancestors to give focus to this component.
   void TakeFocus();
 
+  // While alive, Active() and Focused() are computed once per component, then
+  // read from a cache. The cache is invalidated by SetActiveChild(Component),
+  // TakeFocus(), Add() and Detach(): the active children must not change
+  // otherwise while the scope is alive. ScreenInteractive uses it while
+  // rendering a frame.
+  class FocusScope {
+   public:
+    FocusScope();
+    FocusScope(const FocusScope&) = delete;
+    FocusScope& operator=(const FocusScope&) = delete;
+    ~FocusScope();
+
+   private:
+    uint64_t previous_;
+  };
+
  protected:
   CapturedMouse CaptureMouse(const Event& event);
 
   Components children_;
 
  private:
+  void UpdateFocusCache() const;
+
   ComponentBase* parent_ = nullptr;
   bool in_render = false;
+
+  // The cache of Active() and Focused(), valid for one generation of the
+  // FocusScope.
+  mutable uint64_t focus_generation_ = 0;
+  mutable bool active_ = false;
+  mutable bool ancestors_active_ = false;  // This, and all the ancestors.
+  mutable ComponentBase* active_child_ = nullptr;
+  mutable bool active_child_known_ = false;
 };
 
 }  // namespace ftxui
@@ -100,6 +100,11 @@ struct MenuOption {
   std::function<Element()> elements_prefix;
   std::function<Element()> elements_infix;
   std::function<Element()> elements_postfix;
+  /// Build only the entries displayed, for very long lists. The menu scrolls
+  /// itself to the focused entry, like `virtualList`: don't put it in a
+  /// `frame`. Vertical menus only, one line per entry, without
+  /// `elements_infix`.
+  Ref<bool> virtualized = false;
 
   // Observers:
   std::function<void()> on_change;  ///> Called when the selected entry changes.
@@ -179,6 +184,14 @@ struct InputOption {
   Ref<bool> multiline = true;  ///< Whether the input can be multiline.
   Ref<bool> insert = true;     ///< Insert or overtype character mode.
 
+  /// Only build the lines displayed, and update the line positions as the
+  /// content is edited instead of searching them again. Editing or moving the
+  /// cursor then doesn't depend on the size of the content, which is useful
+  /// for large documents.
+  /// Modifications made to the content elsewhere are detected by checking
+  /// the lines displayed and around the cursor on every frame and event.
+  Ref<bool> virtualized = false;
+
   /// Called when the content changes.
   std::function<void()> on_change = [] {};
   /// Called when the user presses enter.
@@ -200,6 +213,10 @@ struct RadioboxOption {
 
   // Style:
   std::function<Element(const EntryState&)> transform;
+  /// Build only the entries displayed, for very long lists. The radiobox
+  /// scrolls itself to the focused entry, like `virtualList`: don't put it in
+  /// a `frame`. One line per entry.
+  Ref<bool> virtualized = false;
 
   // Observers:
   /// Called when the selected entry changes.
@@ -207,6 +224,24 @@ struct RadioboxOption {
   Ref<int> focused_entry = 0;
 };
 
+/// @brief Option for the VirtualList component.
+/// @ingroup component
+struct VirtualListOption {
+  // Content:
+  ConstRef<int> size = 0;
+  int row_height = 1;
+  Ref<int> selected = 0;
+
+  // Style:
+  /// Build the row at |index|. |focused| is set on the selected row when the
+  /// component is focused.
+  std::function<Element(int index, bool focused)> row;
+
+  // Observers:
+  /// Called when the selected row changes.
+  std::function<void()> on_change = [] {};
+};
+
 struct ResizableSplitOption {
   Component main;
   Component back;
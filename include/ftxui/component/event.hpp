@@ -6,6 +6,7 @@
 
 #include <ftxui/component/mouse.hpp>  // for Mouse
 #include <string>                     // for string, operator==
+#include <string_view>                // for string_view
 
 namespace ftxui {
 
@@ -31,6 +32,7 @@ struct Event {
   static Event Character(wchar_t);
   static Event Special(std::string);
   static Event Mouse(std::string, Mouse mouse);
+  static Event Paste(std::string_view text);
   static Event CursorPosition(std::string, int x, int y);  // Internal
   static Event CursorShape(std::string, int shape);        // Internal
 
@@ -107,6 +109,9 @@ struct Event {
   bool is_mouse() const { return type_ == Type::Mouse; }
   struct Mouse& mouse() { return data_.mouse; }
 
+  bool is_paste() const { return type_ == Type::Paste; }
+  std::string_view paste() const;
+
   // --- Internal Method section -----------------------------------------------
   bool is_cursor_position() const { return type_ == Type::CursorPosition; }
   int cursor_x() const { return data_.cursor.x; }
@@ -130,6 +135,7 @@ struct Event {
     Mouse,
     CursorPosition,
     CursorShape,
+    Paste,
   };
   Type type_ = Type::Unknown;
 
@@ -0,0 +1,82 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_COMPONENT_FRAME_PROFILER_HPP
+#define FTXUI_COMPONENT_FRAME_PROFILER_HPP
+
+#include <cstddef>     // for size_t
+#include <functional>  // for function
+#include <vector>      // for vector
+
+#include "ftxui/dom/elements.hpp"        // for Element
+#include "ftxui/dom/render_profile.hpp"  // for RenderProfile
+
+namespace ftxui {
+
+/// @brief How long each phase of a frame drawn by ScreenInteractive took, and
+/// how much work it did.
+/// @ingroup component
+struct FrameProfile {
+  using Clock = RenderProfile::Clock;
+  using Duration = RenderProfile::Duration;
+
+  // The index of the frame. See ScreenInteractive::FramesPresented().
+  size_t frame = 0;
+
+  // Handling the tasks (events, closures, animations) since the previous
+  // frame, and how many there were.
+  Duration tasks{};
+  int tasks_handled = 0;
+
+  // Building the element of the frame: Component::Render().
+  Duration component{};
+
+  // Laying out, selecting, drawing and applying the shaders.
+  RenderProfile render;
+
+  // Producing the output of the frame, and how big it is.
+  Duration serialize{};
+  size_t bytes = 0;
+
+  // Writing the output to the terminal and flushing it.
+  Duration output{};
+
+  // The whole frame, tasks excluded.
+  Duration total{};
+};
+
+/// @brief The profiles of the last frames drawn by a ScreenInteractive.
+/// @ingroup component
+/// @see ScreenInteractive::EnableProfiler
+class FrameProfiler {
+ public:
+  explicit FrameProfiler(size_t capacity);
+
+  // Add the profile of a frame, replacing the oldest one once full.
+  void Record(const FrameProfile& profile);
+
+  // The number of profiles kept, and at most how many.
+  size_t size() const { return size_; }
+  size_t capacity() const { return frames_.size(); }
+  bool empty() const { return size_ == 0; }
+
+  // The i-th profile kept, from the oldest one.
+  const FrameProfile& operator[](size_t i) const;
+  const FrameProfile& back() const { return (*this)[size_ - 1]; }
+
+  // Called with every profile recorded.
+  void OnFrame(std::function<void(const FrameProfile&)> callback);
+
+  // An element displaying the last profile, and the average and worst ones.
+  Element Overlay() const;
+
+ private:
+  std::vector<FrameProfile> frames_;
+  size_t next_ = 0;
+  size_t size_ = 0;
+  std::function<void(const FrameProfile&)> on_frame_;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_COMPONENT_FRAME_PROFILER_HPP
@@ -4,12 +4,11 @@
 #ifndef FTXUI_COMPONENT_RECEIVER_HPP_
 #define FTXUI_COMPONENT_RECEIVER_HPP_
 
-#include <algorithm>           // for copy, max
-#include <atomic>              // for atomic, __atomic_base
+#include <atomic>              // for atomic, atomic_thread_fence
 #include <condition_variable>  // for condition_variable
 #include <memory>              // for unique_ptr, make_unique
-#include <mutex>               // for mutex, unique_lock
-#include <queue>               // for queue
+#include <mutex>               // for mutex, unique_lock, lock_guard
+#include <optional>            // for optional
 #include <utility>             // for move
 
 namespace ftxui {
@@ -67,72 +66,121 @@ class SenderImpl {
   ReceiverImpl<T>* receiver_;
 };
 
+// The queue is a linked list, where producers append nodes with a single
+// atomic exchange, and the consumer removes them without synchronization.
+// Locking is only needed for the consumer to sleep when the queue is empty.
+//
+// Receive(), ReceiveNonBlocking(), HasPending() and HasQuitted() must be called
+// from a single thread.
 template <class T>
 class ReceiverImpl {
  public:
   Sender<T> MakeSender() {
-    std::unique_lock<std::mutex> lock(mutex_);
     senders_++;
     return std::unique_ptr<SenderImpl<T>>(new SenderImpl<T>(this));
   }
   ReceiverImpl() = default;
+  ReceiverImpl(const ReceiverImpl&) = delete;
+  ReceiverImpl(ReceiverImpl&&) = delete;
+  ReceiverImpl& operator=(const ReceiverImpl&) = delete;
+  ReceiverImpl& operator=(ReceiverImpl&&) = delete;
+  ~ReceiverImpl() {
+    while (head_) {
+      Node* next = head_->next.load(std::memory_order_relaxed);
+      delete head_;
+      head_ = next;
+    }
+  }
 
   bool Receive(T* t) {
-    while (senders_ || !queue_.empty()) {
-      std::unique_lock<std::mutex> lock(mutex_);
-      if (queue_.empty()) {
-        notifier_.wait(lock);
+    while (true) {
+      if (Pop(t)) {
+        return true;
       }
-      if (queue_.empty()) {
-        continue;
+      if (!senders_) {
+        // A sender may have sent a last value before being released.
+        return Pop(t);
       }
-      *t = std::move(queue_.front());
-      queue_.pop();
-      return true;
+      Park();
     }
-    return false;
   }
 
-  bool ReceiveNonBlocking(T* t) {
-    std::unique_lock<std::mutex> lock(mutex_);
-    if (queue_.empty()) {
-      return false;
-    }
-    *t = queue_.front();
-    queue_.pop();
-    return true;
-  }
+  bool ReceiveNonBlocking(T* t) { return Pop(t); }
 
   bool HasPending() {
-    std::unique_lock<std::mutex> lock(mutex_);
-    return !queue_.empty();
+    return head_->next.load(std::memory_order_acquire) != nullptr;
   }
 
-  bool HasQuitted() {
-    std::unique_lock<std::mutex> lock(mutex_);
-    return queue_.empty() && !senders_;
-  }
+  bool HasQuitted() { return !senders_ && !HasPending(); }
 
  private:
   friend class SenderImpl<T>;
 
+  struct Node {
+    std::atomic<Node*> next{nullptr};
+    std::optional<T> value;
+  };
+
   void Receive(T t) {
-    {
-      std::unique_lock<std::mutex> lock(mutex_);
-      queue_.push(std::move(t));
-    }
-    notifier_.notify_one();
+    Node* node = new Node;
+    node->value.emplace(std::move(t));
+    Node* previous = tail_.exchange(node, std::memory_order_acq_rel);
+    previous->next.store(node, std::memory_order_release);
+    Wake();
   }
 
   void ReleaseSender() {
     senders_--;
+    Wake();
+  }
+
+  // Consumer side. |head_| is a node already consumed, its successors are the
+  // pending values.
+  bool Pop(T* t) {
+    Node* next = head_->next.load(std::memory_order_acquire);
+    if (!next) {
+      return false;
+    }
+    *t = std::move(*next->value);
+    next->value.reset();
+    delete head_;
+    head_ = next;
+    return true;
+  }
+
+  // Sleep until a value is sent, or a sender is released.
+  void Park() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    parked_.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (senders_ && !HasPending()) {
+      notifier_.wait(lock);
+    }
+    parked_.store(false, std::memory_order_relaxed);
+  }
+
+  // Producer side. Pairs with the fence in Park(): either the consumer sees
+  // the new state before sleeping, or the producer sees it parked. Only the
+  // first producer to see it parked wakes it up.
+  void Wake() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!parked_.load(std::memory_order_relaxed) ||
+        !parked_.exchange(false, std::memory_order_relaxed)) {
+      return;
+    }
+    // Taking the lock guarantees the consumer is waiting, and won't miss the
+    // notification.
+    { const std::lock_guard<std::mutex> lock(mutex_); }
     notifier_.notify_one();
   }
 
+  Node* head_ = new Node;
+  std::atomic<Node*> tail_{head_};
+  std::atomic<int> senders_{0};
+
   std::mutex mutex_;
-  std::queue<T> queue_;
   std::condition_variable notifier_;
-  std::atomic<int> senders_{0};
+  std::atomic<bool> parked_{false};
 };
 
 template <class T>
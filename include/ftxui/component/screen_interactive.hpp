@@ -5,6 +5,8 @@
 #define FTXUI_COMPONENT_SCREEN_INTERACTIVE_HPP
 
 #include <atomic>                        // for atomic
+#include <chrono>                        // for milliseconds
+#include <cstddef>                       // for size_t
 #include <ftxui/component/receiver.hpp>  // for Receiver, Sender
 #include <functional>                    // for function
 #include <memory>                        // for shared_ptr
@@ -15,12 +17,16 @@
 #include "ftxui/component/animation.hpp"       // for TimePoint
 #include "ftxui/component/captured_mouse.hpp"  // for CapturedMouse
 #include "ftxui/component/event.hpp"           // for Event
+#include "ftxui/component/frame_profiler.hpp"  // for FrameProfiler, FrameProfile
 #include "ftxui/component/task.hpp"            // for Task, Closure
+#include "ftxui/dom/frame_arena.hpp"           // for FrameArena
+#include "ftxui/dom/render_pool.hpp"           // for RenderPool
 #include "ftxui/dom/selection.hpp"             // for SelectionOption
 #include "ftxui/screen/screen.hpp"             // for Screen
 
 namespace ftxui {
 class ComponentBase;
+class HitMap;
 class Loop;
 struct Event;
 
@@ -36,9 +42,17 @@ class ScreenInteractive : public Screen {
   static ScreenInteractive FullscreenAlternateScreen();
   static ScreenInteractive FitComponent();
   static ScreenInteractive TerminalOutput();
+  ~ScreenInteractive();
 
   // Options. Must be called before Loop().
   void TrackMouse(bool enable = true);
+  void BracketedPaste(bool enable = true);
+  void DifferentialRendering(bool enable = true);
+  void UseFrameArena(bool enable = true);
+  void RenderThreads(int threads);
+  void MouseHitTesting(bool enable = true);
+  void MaxFrameRate(float fps);
+  void TaskTimeSlice(animation::Duration duration);
 
   // Return the currently active screen, nullptr if none.
   static ScreenInteractive* Active();
@@ -73,6 +87,15 @@ class ScreenInteractive : public Screen {
   std::string GetSelection();
   void SelectionChange(std::function<void()> callback);
 
+  // Frame statistics.
+  size_t FramesPresented() const { return frames_presented_; }
+  size_t FramesSkipped() const { return frames_skipped_; }
+
+  // Frame profiling. Disabled, and costless, until enabled.
+  void EnableProfiler(size_t frames = 120);
+  void DisableProfiler();
+  FrameProfiler* Profiler() { return profiler_.get(); }
+
  private:
   void ExitNow();
 
@@ -88,8 +111,10 @@ class ScreenInteractive : public Screen {
 
   void HandleTask(Component component, Task& task);
   bool HandleSelection(bool handled, Event event);
+  bool HandlePasteAsCharacters(Component& component, const Event& paste);
   void RefreshSelection();
   void Draw(Component component);
+  void InvalidateFrame();
   void ResetCursorPosition();
 
   void Signal(int signal);
@@ -109,6 +134,31 @@ class ScreenInteractive : public Screen {
                     bool use_alternative_screen);
 
   bool track_mouse_ = true;
+  bool bracketed_paste_ = true;
+
+  // The last frame written to the terminal. When differential rendering is
+  // enabled, only the cells changed since this frame are emitted.
+  bool differential_rendering_ = true;
+  Screen presented_{0, 0};
+
+  // The elements built by Draw() are allocated from this arena, if enabled.
+  bool use_frame_arena_ = false;
+  FrameArena frame_arena_;
+
+  // The threads rendering the frames, if more than one is used.
+  std::unique_ptr<RenderPool> render_pool_;
+
+  // The components drawn on every cell of the last frame, routing the mouse
+  // events, if enabled.
+  std::unique_ptr<HitMap> hit_map_;
+
+  // The profiles of the last frames, if enabled, and the one of the next
+  // frame, filled by the tasks handled in between.
+  std::unique_ptr<FrameProfiler> profiler_;
+  FrameProfile profile_;
+
+  // The output of the frame. Reused to avoid allocating on every frame.
+  std::string output_;
 
   Sender<Task> task_sender_;
   Receiver<Task> task_receiver_;
@@ -119,6 +169,7 @@ class ScreenInteractive : public Screen {
   std::atomic<bool> quit_{false};
   std::thread event_listener_;
   std::thread animation_listener_;
+  Sender<bool> animation_request_sender_;
   bool animation_requested_ = false;
   animation::TimePoint previous_animation_time_;
 
@@ -130,6 +181,14 @@ class ScreenInteractive : public Screen {
 
   bool frame_valid_ = false;
 
+  // Frame rate limit, and the longest time spent handling tasks before drawing
+  // a frame.
+  animation::Duration min_frame_interval_ = animation::Duration(0);
+  animation::Duration task_time_slice_ = std::chrono::milliseconds(16);
+  animation::TimePoint next_frame_time_;
+  size_t frames_presented_ = 0;
+  size_t frames_skipped_ = 0;
+
   bool force_handle_ctrl_c_ = true;
   bool force_handle_ctrl_z_ = true;
 
@@ -5,9 +5,12 @@
 #define FTXUI_DOM_CANVAS_HPP
 
 #include <cstddef>        // for size_t
+#include <cstdint>        // for uint8_t
 #include <functional>     // for function
 #include <string>         // for string
+#include <type_traits>    // for enable_if_t, is_invocable_v
 #include <unordered_map>  // for unordered_map
+#include <vector>         // for vector
 
 #include "ftxui/screen/color.hpp"  // for Color
 #include "ftxui/screen/image.hpp"  // for Pixel, Image
@@ -37,6 +40,17 @@ struct Canvas : Image {
 
   using Stylizer = std::function<void(Pixel&)>;
 
+  // Any function modifying a pixel. The templated overloads taking one call it
+  // inline, instead of through a Stylizer.
+  template <typename F>
+  using IfStylizer = std::enable_if_t<std::is_invocable_v<F&, Pixel&>>;
+
+  // A braille dot.
+  struct Point {
+    int x = 0;
+    int y = 0;
+  };
+
   // Draws using braille characters --------------------------------------------
   void DrawPointOn(int x, int y);
   void DrawPointOff(int x, int y);
@@ -44,6 +58,8 @@ struct Canvas : Image {
   void DrawPoint(int x, int y, bool value);
   void DrawPoint(int x, int y, bool value, const Stylizer& s);
   void DrawPoint(int x, int y, bool value, const Color& color);
+  template <typename F, typename = IfStylizer<F>>
+  void DrawPoint(int x, int y, bool value, F&& style);
   void DrawPointLine(int x1, int y1, int x2, int y2);
   void DrawPointLine(int x1, int y1, int x2, int y2, const Stylizer& s);
   void DrawPointLine(int x1, int y1, int x2, int y2, const Color& color);
@@ -60,6 +76,24 @@ struct Canvas : Image {
   void DrawPointEllipseFilled(int x, int y, int r1, int r2, const Color& color);
   void DrawPointEllipseFilled(int x, int y, int r1, int r2, const Stylizer& s);
 
+  // Draws many braille dots at once -------------------------------------------
+  // The dots are written directly into the braille characters, and the style
+  // is applied once per cell touched, instead of once per dot.
+  void DrawPoints(const Point* points, size_t count);
+  void DrawPoints(const Point* points, size_t count, const Color& color);
+  template <typename F, typename = IfStylizer<F>>
+  void DrawPoints(const Point* points, size_t count, F&& style);
+  // Lines joining the consecutive points.
+  void DrawPolyline(const Point* points, size_t count);
+  void DrawPolyline(const Point* points, size_t count, const Color& color);
+  template <typename F, typename = IfStylizer<F>>
+  void DrawPolyline(const Point* points, size_t count, F&& style);
+  // The polygon whose vertices are the points, with its inside filled.
+  void DrawPolygonFilled(const Point* points, size_t count);
+  void DrawPolygonFilled(const Point* points, size_t count, const Color& color);
+  template <typename F, typename = IfStylizer<F>>
+  void DrawPolygonFilled(const Point* points, size_t count, F&& style);
+
   // Draw using box characters -------------------------------------------------
   // Block are of size 1x2. y is considered to be a multiple of 2.
   void DrawBlockOn(int x, int y);
@@ -109,7 +143,24 @@ struct Canvas : Image {
 
  private:
   bool IsIn(int x, int y) const {
-    return x >= 0 && x < dimx_ && y >= 0 && y < dimy_;
+    return x >= 0 && x < dimx_ * 2 && y >= 0 && y < dimy_ * 4;
+  }
+
+  // Set braille dots, collecting the cells touched into |touched_|.
+  void BeginBatch();
+  void Plot(int x, int y);
+  void PlotSpan(int x_min, int x_max, int y);
+  void EndBatch();
+  void RasterizeSegment(Point a, Point b);
+  void RasterizePoints(const Point* points, size_t count);
+  void RasterizePolyline(const Point* points, size_t count);
+  void RasterizePolygonFilled(const Point* points, size_t count);
+
+  template <typename F>
+  void StyleTouched(F& style) {
+    for (const int xy : touched_) {
+      style(data_[xy]);
+    }
   }
 
   struct Cell {
@@ -123,11 +174,65 @@ struct Canvas : Image {
   // Additional meta data - type of cell for each pixel
   std::vector<Cell> cells_;
 
+  // The cells touched by the last batch of dots, and the dots of the current
+  // batch, a bit per dot and a byte per cell.
+  std::vector<int> touched_;
+  std::vector<uint8_t> dots_;
+
   // No point in using a map for indexing - lots of table overhead and cache unfriendliness
   // just index linearly: i = x + y*width. nothing will ever be faster and friendlier than that, ever
   //std::unordered_map<XY, Cell, XYHash> storage_;
 };
 
+/// @brief Draw a braille dot.
+/// @param x the x coordinate of the dot.
+/// @param y the y coordinate of the dot.
+/// @param value whether the dot is filled or not.
+/// @param style a function modifying the cell, called inline.
+template <typename F, typename>
+void Canvas::DrawPoint(int x, int y, bool value, F&& style) {
+  if (!IsIn(x, y)) {
+    return;
+  }
+  dirty_rows_[y / 4] = 1;
+  style(data_[x / 2 + (y / 4) * dimx_]);
+  if (value) {
+    DrawPointOn(x, y);
+  } else {
+    DrawPointOff(x, y);
+  }
+}
+
+/// @brief Draw braille dots.
+/// @param points the dots.
+/// @param count the number of dots.
+/// @param style a function modifying the cells, called once per cell.
+template <typename F, typename>
+void Canvas::DrawPoints(const Point* points, size_t count, F&& style) {
+  RasterizePoints(points, count);
+  StyleTouched(style);
+}
+
+/// @brief Draw lines of braille dots, joining consecutive points.
+/// @param points the points.
+/// @param count the number of points.
+/// @param style a function modifying the cells, called once per cell.
+template <typename F, typename>
+void Canvas::DrawPolyline(const Point* points, size_t count, F&& style) {
+  RasterizePolyline(points, count);
+  StyleTouched(style);
+}
+
+/// @brief Draw a filled polygon made of braille dots.
+/// @param points the vertices of the polygon.
+/// @param count the number of vertices.
+/// @param style a function modifying the cells, called once per cell.
+template <typename F, typename>
+void Canvas::DrawPolygonFilled(const Point* points, size_t count, F&& style) {
+  RasterizePolygonFilled(points, count);
+  StyleTouched(style);
+}
+
 }  // namespace ftxui
 
 #endif  // FTXUI_DOM_CANVAS_HPP
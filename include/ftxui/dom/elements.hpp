@@ -12,6 +12,7 @@
 #include "ftxui/dom/flexbox_config.hpp"
 #include "ftxui/dom/linear_gradient.hpp"
 #include "ftxui/dom/node.hpp"
+#include "ftxui/dom/time_series.hpp"
 #include "ftxui/screen/box.hpp"
 #include "ftxui/screen/color.hpp"
 #include "ftxui/screen/terminal.hpp"
@@ -88,6 +89,8 @@ Element paragraphAlignRight(const std::string& text);
 Element paragraphAlignCenter(const std::string& text);
 Element paragraphAlignJustify(const std::string& text);
 Element graph(GraphFunction);
+Element timeSeries(std::shared_ptr<TimeSeries>,
+                   TimeSeriesConfig config = TimeSeriesConfig());
 Element emptyElement();
 Element canvas(ConstRef<Canvas>);
 Element canvas(int width, int height, std::function<void(Canvas&)>);
@@ -171,6 +174,12 @@ Element yframe(Element);
 Element focus(Element);
 Element select(Element e);  // Deprecated - Alias for focus.
 
+// A scrollable list, only building the rows it displays.
+Element virtualList(int count,
+                    int row_height,
+                    std::function<Element(int)> row,
+                    int focused = -1);
+
 // --- Cursor ---
 // Those are similar to `focus`, but also change the shape of the cursor.
 Element focusCursorBlock(Element);
@@ -0,0 +1,117 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_DOM_FRAME_ARENA_HPP
+#define FTXUI_DOM_FRAME_ARENA_HPP
+
+#include <atomic>   // for atomic
+#include <cstddef>  // for size_t
+#include <memory>   // for allocate_shared, make_shared, shared_ptr
+#include <new>      // for operator new, operator delete
+#include <utility>  // for forward
+
+namespace ftxui {
+
+/// @brief A bump allocator for the elements built during a frame.
+/// @ingroup dom
+///
+/// While a FrameArena::Scope is alive, the elements created by the
+/// functions of ftxui/dom/elements.hpp are allocated from the arena instead of
+/// the heap. Reset() then makes the memory available to the next frame.
+///
+/// Memory is only reused once every element allocated from it is destroyed.
+/// Holding an element across frames is therefore safe: the memory it uses is
+/// simply not reused until it is released.
+class FrameArena {
+ public:
+  FrameArena() = default;
+  FrameArena(const FrameArena&) = delete;
+  FrameArena& operator=(const FrameArena&) = delete;
+  ~FrameArena();
+
+  // Reuse the memory of the destroyed elements.
+  void Reset();
+
+  // Allocate from the arena of the current thread, while this is alive.
+  class Scope {
+   public:
+    explicit Scope(FrameArena* arena);
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+    ~Scope();
+
+   private:
+    FrameArena* previous_;
+  };
+
+  // The arena of the current thread, or nullptr.
+  static FrameArena* Current();
+
+  // The biggest allocation served by the arena. The others use the heap.
+  static constexpr size_t kMaxAllocation = 1024;
+
+  template <class T>
+  class Allocator {
+   public:
+    using value_type = T;
+
+    explicit Allocator(FrameArena* arena) : arena_(arena) {}
+    template <class U>
+    Allocator(const Allocator<U>& other)  // NOLINT
+        : arena_(other.arena_) {}
+
+    T* allocate(size_t n) {
+      if (n * sizeof(T) > kMaxAllocation) {
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+      }
+      return static_cast<T*>(arena_->Allocate(n * sizeof(T), alignof(T)));
+    }
+
+    // The arena may be gone: the memory is found from the pointer only.
+    void deallocate(T* p, size_t n) {
+      if (n * sizeof(T) > kMaxAllocation) {
+        ::operator delete(p);
+        return;
+      }
+      FrameArena::Deallocate(p);
+    }
+
+    template <class U>
+    bool operator==(const Allocator<U>& other) const {
+      return arena_ == other.arena_;
+    }
+    template <class U>
+    bool operator!=(const Allocator<U>& other) const {
+      return arena_ != other.arena_;
+    }
+
+   private:
+    template <class U>
+    friend class Allocator;
+    FrameArena* arena_;
+  };
+
+ private:
+  struct Block;
+
+  void* Allocate(size_t size, size_t alignment);
+  static void Deallocate(void* pointer);
+  static void Release(Block* block);
+
+  Block* block_ = nullptr;
+};
+
+/// @brief Create a Node, from the arena of the current thread if any.
+/// @ingroup dom
+template <class T, class... Args>
+std::shared_ptr<T> MakeNode(Args&&... args) {
+  if (FrameArena* arena = FrameArena::Current()) {
+    return std::allocate_shared<T>(FrameArena::Allocator<T>(arena),
+                                   std::forward<Args>(args)...);
+  }
+  return std::make_shared<T>(std::forward<Args>(args)...);
+}
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_FRAME_ARENA_HPP
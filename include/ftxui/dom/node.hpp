@@ -48,6 +48,10 @@ class Node {
   // Step 4: Draw this element.
   virtual void Render(Screen& screen);
 
+  // Called instead of Render() on an element out of the stencil. It draws
+  // nothing, but elements reporting their box, like reflect(), must clip it.
+  virtual void RenderHidden(Screen& screen);
+
   virtual std::string GetSelectedContent(Selection& selection);
 
   // Layout may not resolve within a single iteration for some elements. This
@@ -59,12 +63,32 @@ class Node {
   };
   virtual void Check(Status* status);
 
+  // Memoized steps 1 and 2, used by parents on their children. A subtree kept
+  // from a previous frame doesn't compute its requirement again, and isn't laid
+  // out again unless its box changes.
+  void ComputeRequirementCached();
+  void SetBoxCached(Box box);
+
   friend void Render(Screen& screen, Node* node, Selection& selection);
 
  protected:
+  // Same as Render(), for containers whose children don't overlap. With a
+  // RenderPool in scope, the children are rendered concurrently.
+  void RenderDisjoint(Screen& screen);
+
   Elements children_;
   Requirement requirement_;
   Box box_;
+
+  // Whether the layout of this node only depends on its children and on the
+  // box it is given. Nodes depending on anything else, like a previous layout
+  // iteration or an external state, must set it to false.
+  bool layout_cacheable_ = true;
+
+ private:
+  bool requirement_cached_ = false;
+  bool box_cached_ = false;
+  Box cached_box_;
 };
 
 void Render(Screen& screen, const Element& element);
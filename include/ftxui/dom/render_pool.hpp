@@ -0,0 +1,87 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_DOM_RENDER_POOL_HPP
+#define FTXUI_DOM_RENDER_POOL_HPP
+
+#include <atomic>              // for atomic
+#include <condition_variable>  // for condition_variable
+#include <memory>              // for unique_ptr
+#include <mutex>               // for mutex
+#include <thread>              // for thread
+#include <vector>              // for vector
+
+namespace ftxui {
+
+/// @brief A pool of threads rendering elements concurrently.
+/// @ingroup dom
+///
+/// While a RenderPool::Scope is alive, the containers whose children don't
+/// overlap (hbox, vbox, gridbox) render them concurrently. Each thread owns a
+/// queue of tasks, and steals from the others once its own is empty.
+///
+/// Elements rendered concurrently must draw within their box and the stencil.
+class RenderPool {
+ public:
+  // |threads| counts the thread rendering, so |threads - 1| are started.
+  explicit RenderPool(int threads);
+  RenderPool(const RenderPool&) = delete;
+  RenderPool& operator=(const RenderPool&) = delete;
+  ~RenderPool();
+
+  int threads() const { return static_cast<int>(queues_.size()); }
+
+  // Render with the pool on the current thread, while this is alive.
+  class Scope {
+   public:
+    explicit Scope(RenderPool* pool);
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+    ~Scope();
+
+   private:
+    RenderPool* previous_;
+  };
+
+  // The pool of the current thread, or nullptr.
+  static RenderPool* Current();
+
+  // Call |task(i)| for every i in [0, count), possibly concurrently, and
+  // return once every call returned. The calling thread takes part.
+  template <class F>
+  void ParallelFor(int count, F&& task) {
+    Run(count, &Invoke<F>, &task);
+  }
+
+ private:
+  struct Batch;
+  struct Task {
+    Batch* batch;
+    int index;
+  };
+  struct Queue;
+
+  template <class F>
+  static void Invoke(void* task, int index) {
+    (*static_cast<F*>(task))(index);
+  }
+
+  void Run(int count, void (*run)(void*, int), void* context);
+  bool Pop(int queue, Task* task);
+  void Execute(const Task& task);
+  void Work(int queue);
+  int QueueOfThisThread() const;
+
+  std::vector<std::unique_ptr<Queue>> queues_;
+  std::vector<std::thread> workers_;
+
+  // The number of queued tasks. Idle workers sleep until it is non zero.
+  std::atomic<int> pending_{0};
+  std::mutex mutex_;
+  std::condition_variable wake_up_;
+  bool stop_ = false;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_RENDER_POOL_HPP
@@ -0,0 +1,55 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_DOM_RENDER_PROFILE_HPP
+#define FTXUI_DOM_RENDER_PROFILE_HPP
+
+#include <chrono>  // for steady_clock
+
+namespace ftxui {
+
+/// @brief How long each step of Render() took, and how much work it did.
+/// @ingroup dom
+///
+/// While a RenderProfile::Scope is alive, Render() adds to the profile. Nothing
+/// is measured otherwise.
+struct RenderProfile {
+  using Clock = std::chrono::steady_clock;
+  using Duration = Clock::duration;
+
+  // Step 1 and 2: computing the requirements and laying out the boxes.
+  Duration layout{};
+  // Step 3: computing the selection.
+  Duration select{};
+  // Step 4: drawing the elements.
+  Duration render{};
+  // Step 5: applying the shaders of the screen.
+  Duration shader{};
+
+  // The number of iterations of the layout algorithm.
+  int layout_iterations = 0;
+  // The number of elements of the tree rendered.
+  int nodes = 0;
+  // The number of elements whose requirement was computed, and not reused
+  // from a previous frame.
+  int nodes_laid_out = 0;
+
+  // Add to |profile| on the current thread, while this is alive.
+  class Scope {
+   public:
+    explicit Scope(RenderProfile* profile);
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+    ~Scope();
+
+   private:
+    RenderProfile* previous_;
+  };
+
+  // The profile of the current thread, or nullptr.
+  static RenderProfile* Current();
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_RENDER_PROFILE_HPP
@@ -0,0 +1,101 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_DOM_TIME_SERIES_HPP
+#define FTXUI_DOM_TIME_SERIES_HPP
+
+#include <atomic>   // for atomic
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t
+#include <memory>   // for unique_ptr
+#include <mutex>    // for mutex
+#include <vector>   // for vector
+
+namespace ftxui {
+
+/// @brief The last samples of a stream of values, drawn by timeSeries().
+/// @ingroup dom
+///
+/// Any number of threads can Push() samples concurrently, without locking.
+/// Once full, each sample replaces the oldest one.
+///
+/// Drawing aggregates the samples into columns of consecutive samples. The
+/// columns are aligned on the index of the samples, so that those already
+/// complete are kept from one frame to the next: a frame only aggregates the
+/// samples pushed since the previous one.
+class TimeSeries {
+ public:
+  explicit TimeSeries(size_t capacity);
+  TimeSeries(const TimeSeries&) = delete;
+  TimeSeries& operator=(const TimeSeries&) = delete;
+  ~TimeSeries();
+
+  // Append a sample. Thread safe and lock free.
+  void Push(float value);
+
+  size_t capacity() const { return capacity_; }
+  // The number of samples pushed since the creation.
+  uint64_t pushed() const { return pushed_.load(std::memory_order_acquire); }
+  // The number of samples kept.
+  size_t size() const;
+
+  // The aggregate of consecutive samples.
+  struct Column {
+    float min = 0.f;
+    float max = 0.f;
+    float avg = 0.f;
+    int count = 0;  // 0 when the column has no sample.
+  };
+
+  // Aggregate the last |window| samples kept (all of them when 0) into
+  // |columns| columns, from the oldest to the newest.
+  void Downsample(int columns, size_t window, std::vector<Column>& out);
+
+ private:
+  // A sample, and the index it was pushed at, plus one. They are stored
+  // together, so that a reader can tell a sample from the previous one in the
+  // same slot.
+  struct Slot {
+    std::atomic<uint64_t> value_and_index{0};
+  };
+
+  struct Bucket {
+    uint64_t id = UINT64_MAX;
+    bool complete = false;
+    Column column;
+  };
+
+  Bucket Aggregate(uint64_t id, uint64_t head) const;
+
+  const size_t capacity_;
+  std::unique_ptr<Slot[]> slots_;
+  std::atomic<uint64_t> pushed_{0};
+
+  // The columns aggregated by the previous frames, indexed by their id modulo
+  // the size. Only accessed by Downsample().
+  std::mutex mutex_;
+  uint64_t bucket_size_ = 0;
+  std::vector<Bucket> buckets_;
+};
+
+/// @brief How timeSeries() draws a TimeSeries.
+/// @ingroup dom
+struct TimeSeriesConfig {
+  enum class Style {
+    Braille,  ///< The range of each column, with braille dots.
+    Block,    ///< The average of each column, as an area. See graph().
+  };
+  Style style = Style::Braille;
+
+  /// The values at the bottom and at the top. When min >= max, they fit the
+  /// samples displayed.
+  float min = 0.f;
+  float max = 0.f;
+
+  /// How many of the last samples are displayed. 0 displays all those kept.
+  size_t window = 0;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_TIME_SERIES_HPP
@@ -317,6 +317,7 @@ class Color {
   constexpr bool operator!=(const Color& rhs) const;
 
   std::string Print(bool is_background_color) const;
+  void Print(bool is_background_color, std::string& out) const;
   constexpr bool IsOpaque() const { return alpha_ == 255; }
 
  private:
@@ -6,6 +6,7 @@
 
 #include <array>  // for array
 #include <cmath>
+#include <cstddef>  // for size_t
 #include <cstdint>
 #include <string>
 
@@ -33,6 +34,31 @@ constexpr std::array<std::string_view, 33> palette16code = {
     "97", "107",  //
 };
 
+// Decimal representation of every uint8_t. Each entry holds up to 3 digits,
+// followed by their count.
+constexpr std::array<char, 256 * 4> g_uint8_decimal = [] {
+  std::array<char, 256 * 4> table{};
+  for (int i = 0; i < 256; ++i) {
+    char* entry = table.data() + i * 4;  // NOLINT
+    size_t count = 0;
+    if (i >= 100) {
+      entry[count++] = char('0' + i / 100);  // NOLINT
+    }
+    if (i >= 10) {
+      entry[count++] = char('0' + i / 10 % 10);  // NOLINT
+    }
+    entry[count++] = char('0' + i % 10);  // NOLINT
+    entry[3] = char(count);               // NOLINT
+  }
+  return table;
+}();
+
+// Append the decimal representation of |value| to |out|.
+inline void AppendUint8(std::string& out, uint8_t value) {
+  const char* entry = g_uint8_decimal.data() + value * 4;  // NOLINT
+  out.append(entry, size_t(entry[3]));                     // NOLINT
+}
+
 }  // namespace
 
 constexpr bool Color::operator==(const Color& rhs) const {
@@ -45,33 +71,60 @@ constexpr bool Color::operator!=(const Color& rhs) const {
 }
 
 inline std::string Color::Print(bool is_background_color) const {
+  std::string out;
+  Print(is_background_color, out);
+  return out;
+}
+
+/// @brief Append the SGR parameters selecting this color to |out|.
+/// @param is_background_color Whether this is used as the background color.
+/// @param out The string to append to. Its capacity is reused, so that printing
+///            into a long lived string doesn't allocate.
+inline void Color::Print(bool is_background_color, std::string& out) const {
   if (is_background_color) {
     switch (type_) {
       case ColorType::Palette1:
-        return "49";
+        out += "49";
+        return;
       case ColorType::Palette16:
-        return std::string(palette16code[2 * red_ + 1]);  // NOLINT
+        out += palette16code[2 * red_ + 1];  // NOLINT
+        return;
       case ColorType::Palette256:
-        return "48;5;" + std::to_string(red_);
+        out += "48;5;";
+        AppendUint8(out, red_);
+        return;
       case ColorType::TrueColor:
-        return "48;2;" + std::to_string(red_) + ";" + std::to_string(green_) +
-               ";" + std::to_string(blue_);
+        out += "48;2;";
+        AppendUint8(out, red_);
+        out += ';';
+        AppendUint8(out, green_);
+        out += ';';
+        AppendUint8(out, blue_);
+        return;
     }
   } else {
     switch (type_) {
       case ColorType::Palette1:
-        return "39";
+        out += "39";
+        return;
       case ColorType::Palette16:
-        return std::string(palette16code[2 * red_]);  // NOLINT
+        out += palette16code[2 * red_];  // NOLINT
+        return;
       case ColorType::Palette256:
-        return "38;5;" + std::to_string(red_);
+        out += "38;5;";
+        AppendUint8(out, red_);
+        return;
       case ColorType::TrueColor:
-        return "38;2;" + std::to_string(red_) + ";" + std::to_string(green_) +
-               ";" + std::to_string(blue_);
+        out += "38;2;";
+        AppendUint8(out, red_);
+        out += ';';
+        AppendUint8(out, green_);
+        out += ';';
+        AppendUint8(out, blue_);
+        return;
     }
   }
   // NOTREACHED();
-  return "";
 }
 
 /// @brief Build a transparent color.
@@ -4,6 +4,7 @@
 #ifndef FTXUI_SCREEN_IMAGE_HPP
 #define FTXUI_SCREEN_IMAGE_HPP
 
+#include <cstdint>  // for uint8_t
 #include <string>  // for string, basic_string, allocator
 #include <vector>  // for vector
 
@@ -25,15 +26,17 @@ class Image {
   Image& operator = (const Image&);
   Image& operator = (Image&&);
 
-  // Access a cell (Pixel) in the grid at a given position
+  // Access a cell (Pixel) in the grid at a given position. Mutable access
+  // marks the row as dirty.
   FTXUI_FORCE_INLINE()
   auto& PixelAt(int x, int y) {
-    return pixels_[x + y * dimx_];
+    dirty_rows_[y] = 1;
+    return data_[x + y * dimx_];
   }
 
   FTXUI_FORCE_INLINE()
   auto& PixelAt(int x, int y) const {
-    return pixels_[x + y * dimx_];
+    return data_[x + y * dimx_];
   }
 
   // Get screen dimensions
@@ -43,28 +46,43 @@ class Image {
   // Fill the image with space and default style
   void Clear();
 
+  // Dirty rows may hold something else than blank pixels. Every other row is
+  // known to be blank, and is skipped by Clear() and by the serializers.
+  FTXUI_FORCE_INLINE()
+  bool IsDirty(int y) const { return dirty_rows_[y] != 0; }
+  void MarkDirty(int y_min, int y_max);
+  void MarkAllDirty();
+
   Box stencil;
 
   auto& get_pool  () const { return pool_;   }
   auto& get_pool  ()       { return pool_;   }
   auto& get_pixels() const { return pixels_; }
+  // Writing through the mutable pixels doesn't mark any row as dirty; use
+  // MarkDirty() when doing so. A fork (see Screen::Fork()) has no pixels of
+  // its own, and returns an empty vector.
   auto& get_pixels()       { return pixels_; }
 
  protected:
   int dimx_;
   int dimy_;
   
-  // acts as a pool, interfaced by pixels_. stuff is generally just appended on the
-  // back, until you run compactify(), which passes through all pixels and
-  // discards any bytes in this string, that aren't used anymore - it should happen
-  // anyway, if memory behind the string moves on reallocation. this shouldn't really
-  // happen too often - only if you push a really long grapheme (>4 bytes). it is much more efficient to reallocate this buffer, 
-  // instead of allocate a new std::string per pixel every time something changes
+  // Storage for the graphemes too big to be packed into a pixel. Identical
+  // graphemes share their storage. It is reset by Clear() when it grows too
+  // big, instead of allocating a std::string per pixel.
   PackedString::Pool pool_;
 
   // No need of vector of vectors - these are just excess allocations
   // just index linearly: i = x + y*width
   std::vector<Pixel> pixels_;
+
+  // The pixels drawn into: those of |pixels_|, or those of another screen for
+  // a fork.
+  Pixel* data_ = nullptr;
+
+  // One byte per row, non-zero when the row is dirty. Bytes rather than a
+  // std::vector<bool>, so that marking a row in PixelAt is a single store.
+  std::vector<uint8_t> dirty_rows_;
 };
 
 }  // namespace ftxui
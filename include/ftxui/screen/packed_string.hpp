@@ -1,8 +1,10 @@
 #pragma once
 #include <cstdint>
 #include <cstring>
-#include <vector>
+#include <functional>
 #include <string_view>
+#include <unordered_map>
+#include <vector>
 
 #if defined(_MSC_VER)
    #define FTXUI_FORCE_INLINE() __forceinline
@@ -12,11 +14,96 @@
 
 namespace ftxui {
 
+/// @brief Storage for the strings too big to be packed into a PackedString
+/// @details Strings are appended, and identical strings are stored only once,
+///          so that recurring graphemes (emoji, combining sequences) don't grow
+///          the pool. Memory is only reclaimed by Clear(), once no PackedString
+///          refers to the pool anymore.
+class PackedStringPool
+{
+public:
+  PackedStringPool() = default;
+
+  /// @brief A pool extending |parent|
+  /// @details The strings of |parent| are visible from this pool, and new
+  ///          ones are stored in this pool, at offsets following those of
+  ///          |parent|. Used to draw concurrently, one pool per thread.
+  /// @attention |parent| must not be modified while this pool is in use
+  explicit PackedStringPool(const PackedStringPool* parent)
+      : parent_(parent), base_(parent->end()) {}
+
+  /// @brief Store a string, or find an identical one already stored
+  /// @return the offset of the string in the pool
+  uint32_t Intern(std::string_view text) {
+    const size_t hash = std::hash<std::string_view>()(text);
+    uint32_t offset = 0;
+    if (Find(text, hash, offset))
+      return offset;
+
+    offset = end();
+    const size_t index = words_.size();
+    words_.resize(words_.size() + 1 + (text.size() + 3) / 4);
+    words_[index] = static_cast<uint32_t>(text.size());
+    std::memcpy(words_.data() + index + 1, text.data(), text.size());
+
+    // On a hash collision, the first string stays the interned one.
+    interned_.emplace(hash, offset);
+    return offset;
+  }
+
+  FTXUI_FORCE_INLINE()
+  std::string_view View(uint32_t offset) const {
+    const PackedStringPool* pool = this;
+    while (offset < pool->base_)
+      pool = pool->parent_;
+    const uint32_t* word = pool->words_.data() + (offset - pool->base_);
+    return std::string_view(
+       reinterpret_cast<const char*>(word + 1),
+       static_cast<size_t>(*word)
+    );
+  }
+
+  /// @brief Forget every string
+  /// @attention the PackedString using the pool are left dangling
+  void Clear() {
+    words_.clear();
+    interned_.clear();
+  }
+
+  /// @brief The number of 32-bit words used
+  size_t size() const { return words_.size(); }
+  bool empty() const { return words_.empty(); }
+
+  /// @brief The first offset stored by this pool, and not by its parent
+  uint32_t base() const { return base_; }
+
+  /// @brief The offset of the next string stored
+  uint32_t end() const { return base_ + static_cast<uint32_t>(words_.size()); }
+
+private:
+  bool Find(std::string_view text, size_t hash, uint32_t& offset) const {
+    const auto it = interned_.find(hash);
+    if (it != interned_.end() && View(it->second) == text) {
+      offset = it->second;
+      return true;
+    }
+    return parent_ && parent_->Find(text, hash, offset);
+  }
+
+  // For every string: its size, followed by its characters padded to 4 bytes.
+  std::vector<uint32_t> words_;
+  // Hash of a string -> its offset in the pool.
+  std::unordered_map<size_t, uint32_t> interned_;
+
+  const PackedStringPool* parent_ = nullptr;
+  uint32_t base_ = 0;
+};
+
 /// @brief packs strings into an integer-size if possible
 /// @attention used to represent pixel character data for images no bigger than 4096x4096
 struct PackedString
 {
-  using Pool = std::vector<uint32_t>;
+  using Pool = PackedStringPool;
 
 private:
   union {
@@ -68,15 +155,9 @@ public:
           str[i] = text[i];
         break;
 
-      default: {
+      default:
         big = 1;
-        pointer = pool.size();
-        pool.resize(pool.size() + 1 + text.size() / 4 + text.size() % 4);
-        pool[pointer] = static_cast<uint32_t>(text.size());
-        auto as_char = reinterpret_cast<char*>(pool.data() + pointer + 1);
-        for (size_t i = 0; i < text.size(); ++i)
-          as_char[i] = text[i];
-      }
+        pointer = pool.Intern(text);
     }    
   }
 
@@ -94,25 +175,11 @@ public:
           str[i] = text[i];
         break;
 
-      default: {
-        const auto aligned_size = text.size() + text.size() % 4u;
-        if (big && pool[pointer] <= aligned_size) {
-           // We can reuse the pool allocation
-           pool[pointer] = static_cast<uint32_t>(text.size());
-           auto as_char = reinterpret_cast<char*>(pool.data() + pointer + 1);
-           for (size_t i = 0; i < text.size(); ++i)
-              as_char[i] = text[i];
-        }
-        else {
-           big = 1;
-           pointer = pool.size();
-           pool.resize(pool.size() + 1 + aligned_size / 4);
-           pool[pointer] = static_cast<uint32_t>(text.size());
-           auto as_char = reinterpret_cast<char*>(pool.data() + pointer + 1);
-           for (size_t i = 0; i < text.size(); ++i)
-              as_char[i] = text[i];
-        }
-      }
+      default:
+        // The allocation may be shared with other pixels, so it is never
+        // overwritten in place.
+        big = 1;
+        pointer = pool.Intern(text);
     }    
   }
 
@@ -131,13 +198,16 @@ public:
      return !big;
   }
 
+  // @attention only meaningful if !is_small()
+  FTXUI_FORCE_INLINE()
+  uint32_t get_offset() const {
+     return pointer;
+  }
+
   FTXUI_FORCE_INLINE()
   std::string_view get_view(const Pool& pool) const {
      if (big) {
-        return std::string_view(
-           reinterpret_cast<const char*>(pool.data() + pointer + 1),
-           static_cast<size_t>(pool[pointer])
-        );
+        return pool.View(pointer);
      }
      else {
         (void)pool;
@@ -154,7 +224,7 @@ public:
   // @attention this is unsafe, use only if you can guarantee !big
   FTXUI_FORCE_INLINE()
   bool operator == (const PackedString& rhs) const {
-      return size == rhs.size && strncmp(str, rhs.str, size);
+      return size == rhs.size && std::memcmp(str, rhs.str, size) == 0;
   }
 
   // @attention this is unsafe, use only if you can guarantee !big
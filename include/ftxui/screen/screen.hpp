@@ -32,6 +32,12 @@ class Screen : public Image {
   static Screen Create(Dimensions width, Dimensions height);
 
   std::string ToString() const;
+  void ToString(std::string& out) const;
+
+  // Produce the output transforming |previous|, already presented on the
+  // terminal, into this screen. Only the changed cells are emitted.
+  std::string ToStringDiff(const Screen& previous) const;
+  void ToStringDiff(const Screen& previous, std::string& out) const;
 
   // Print the Screen on to the terminal.
   void Print() const;
@@ -73,6 +79,13 @@ class Screen : public Image {
   const SelectionStyle& GetSelectionStyle() const;
   void SetSelectionStyle(SelectionStyle decorator);
 
+  // A screen drawing into the pixels of this one, with its own graphemes pool,
+  // hyperlinks and dirty rows. Forks can draw concurrently into disjoint
+  // regions, as long as this screen isn't modified meanwhile. Join() then
+  // brings back what a fork drew into |box|.
+  Screen Fork();
+  void Join(const Screen& fork, Box box);
+
  protected:
   Cursor cursor_;
   std::vector<std::string> hyperlinks_ = {""};
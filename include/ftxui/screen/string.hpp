@@ -4,8 +4,10 @@
 #ifndef FTXUI_SCREEN_STRING_HPP
 #define FTXUI_SCREEN_STRING_HPP
 
-#include <string>  // for string, wstring, to_string
-#include <vector>  // for vector
+#include <cstdint>      // for uint32_t
+#include <string>       // for string, wstring, to_string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
 
 namespace ftxui {
 std::string to_string(const std::wstring_view& s);
@@ -22,6 +24,24 @@ int string_width(const std::string_view&);
 // ones.
 std::vector<std::string> Utf8ToGlyphs(const std::string_view& input);
 
+// The bytes of a glyph, inside the string it was found in.
+struct GlyphSpan {
+  uint32_t offset = 0;
+  uint32_t size = 0;
+
+  std::string_view In(const std::string_view& input) const {
+    return input.substr(offset, size);
+  }
+};
+
+// Same as Utf8ToGlyphs, without copying the glyphs. One span per cell, so a
+// fullwidth glyph is followed by an empty span. A span can't skip over an
+// ignored control character, so a combining character following one is
+// dropped instead of modifying the previous glyph. |complete| is then set to
+// false.
+std::vector<GlyphSpan> Utf8ToGlyphSpans(const std::string_view& input,
+                                        bool* complete = nullptr);
+
 // Map every cells drawn by |input| to their corresponding Glyphs. Half-size
 // Glyphs takes one cell, full-size Glyphs take two cells.
 std::vector<int> CellToGlyphIndex(const std::string_view& input);
@@ -12,14 +12,24 @@
 #include "ftxui/screen/string.hpp"
 #include "ftxui/screen/packed_string.hpp"
 
+#include <algorithm>  // for max, min
 #include <array>    // for array
 #include <cstddef>  // for size_t
-#include <cstdint>  // for uint32_t, uint8_t, uint16_t, int32_t
+#include <cstdint>  // for uint32_t, uint8_t, uint16_t, int32_t, uint64_t
+#include <cstring>  // for memcpy
 #include <string>   // for string, basic_string, wstring
 #include <tuple>    // for _Swallow_assign, ignore
 #include <vector>
 
 #include "ftxui/screen/deprecated.hpp"       // for wchar_width, wstring_width
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define FTXUI_STRING_SSE2
+#include <emmintrin.h>  // for _mm_loadu_si128, _mm_cmpgt_epi8, _mm_movemask_epi8
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define FTXUI_STRING_NEON
+#include <arm_neon.h>  // for vld1q_u8, vcgeq_u8, vminvq_u8
+#endif
+
 //#include "ftxui/screen/string_internal.hpp"  // for WordBreakProperty, EatCodePoint, CodepointToWordBreakProperty, GlyphCount, GlyphIterate, GlyphNext, GlyphPrevious, IsCombining, IsControl, IsFullWidth, Utf8ToWordBreakProperty
 
 namespace ftxui {
@@ -1201,6 +1211,154 @@ bool Bisearch(uint32_t ucs, const std::array<C, N>& table, C* out) {
   return false;
 }
 
+// The width properties of the codepoints of the Basic Multilingual Plane, two
+// bits per codepoint: combining, then fullwidth. They are looked up instead of
+// binary searching the tables above. The codepoints are grouped by blocks of
+// 256, and identical blocks are stored once.
+constexpr uint32_t kWidthBlockCount = 0x10000 / 256;
+constexpr uint32_t kWidthBlockWords = 256 * 2 / 64;
+using WidthBlock = std::array<uint64_t, kWidthBlockWords>;
+
+template <size_t N>
+struct BmpWidthTable {
+  size_t count = 0;  // The number of blocks.
+  std::array<uint8_t, kWidthBlockCount> index{};
+  std::array<WidthBlock, N> blocks{};
+};
+
+constexpr auto MakeBmpWidthTable() {
+  BmpWidthTable<kWidthBlockCount> table;
+  std::array<uint64_t, kWidthBlockCount> checksums{};
+  WidthBlock block{};
+  size_t interval_extend = 0;
+  size_t interval_full = 0;
+  for (uint32_t b = 0; b < kWidthBlockCount; ++b) {
+    // Set the bits of the intervals overlapping the block. Both tables are
+    // sorted, so they are walked once over all the blocks.
+    block = {};
+    const uint32_t first = b * 256;
+    const uint32_t last = first + 255;
+    auto set = [&](const auto& intervals, size_t& i, uint32_t bit) {
+      while (i < intervals.size() && intervals[i].last < first)  // NOLINT
+        ++i;
+      for (size_t j = i; j < intervals.size() && intervals[j].first <= last;
+           ++j) {
+        const uint32_t from = std::max(intervals[j].first, first) - first;
+        const uint32_t to = std::min(intervals[j].last, last) - first;
+        // Set the bits word by word.
+        for (uint32_t ucs = from; ucs <= to; ucs = ucs / 32 * 32 + 32) {
+          const uint32_t low = (ucs % 32) * 2;
+          const uint32_t high = (std::min(to, ucs / 32 * 32 + 31) % 32) * 2 + 1;
+          const uint64_t range = (high == 63 ? ~uint64_t(0)
+                                             : (uint64_t(1) << (high + 1)) - 1) &
+                                 ~((uint64_t(1) << low) - 1);
+          block[ucs / 32] |= range & (0x5555555555555555 << bit);  // NOLINT
+        }
+      }
+    };
+    set(g_extend_characters, interval_extend, 0);
+    set(g_full_width_characters, interval_full, 1);
+
+    // Reuse an identical block. Compare their checksums first, this is
+    // evaluated by every translation unit.
+    uint64_t checksum = 0;
+    for (uint32_t w = 0; w < kWidthBlockWords; ++w)
+      checksum = checksum * 31 + block[w];  // NOLINT
+    size_t found = 0;
+    for (; found < table.count; ++found) {
+      if (checksums[found] != checksum)  // NOLINT
+        continue;
+      bool same = true;
+      for (uint32_t w = 0; w < kWidthBlockWords && same; ++w)
+        same = table.blocks[found][w] == block[w];  // NOLINT
+      if (same)
+        break;
+    }
+    if (found == table.count) {
+      checksums[table.count] = checksum;     // NOLINT
+      table.blocks[table.count++] = block;  // NOLINT
+    }
+    table.index[b] = static_cast<uint8_t>(found);  // NOLINT
+  }
+  return table;
+}
+
+constexpr auto g_bmp_width = []() constexpr {
+  constexpr auto full = MakeBmpWidthTable();
+  BmpWidthTable<full.count> table;
+  table.count = full.count;
+  table.index = full.index;
+  for (size_t i = 0; i < full.count; ++i)
+    table.blocks[i] = full.blocks[i];  // NOLINT
+  return table;
+}();
+
+// Return the width properties of a codepoint of the Basic Multilingual Plane.
+FTXUI_FORCE_INLINE()
+uint32_t BmpWidthProperties(uint32_t ucs) {
+  const WidthBlock& block = g_bmp_width.blocks[g_bmp_width.index[ucs >> 8]];
+  return (block[(ucs & 0xFF) / 32] >> ((ucs % 32) * 2)) & 0b11;  // NOLINT
+}
+
+// Whether |c| is a printable ASCII character. Those are glyphs one cell wide,
+// with no table to look up.
+FTXUI_FORCE_INLINE()
+bool IsPrintableAscii(char c) {
+  return c >= 0x20 && c < 0x7F;  // NOLINT
+}
+
+// Return the end of the run of printable ASCII characters beginning at
+// |start|. They are scanned 16 (or 8) at a time, the end of the run is then
+// found one character at a time.
+FTXUI_FORCE_INLINE()
+size_t AsciiRunEnd(const std::string_view& input, size_t start) {
+  const char* data = input.data();
+  const size_t size = input.size();
+#if defined(FTXUI_STRING_SSE2)
+  const __m128i low = _mm_set1_epi8(0x1F);
+  const __m128i high = _mm_set1_epi8(0x7F);
+  while (start + 16 <= size) {
+    // Bytes above 0x7F are negative, so they fail the first comparison.
+    const __m128i chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + start));
+    const __m128i printable = _mm_and_si128(_mm_cmpgt_epi8(chunk, low),
+                                            _mm_cmplt_epi8(chunk, high));
+    if (_mm_movemask_epi8(printable) != 0xFFFF)
+      break;
+    start += 16;
+  }
+#elif defined(FTXUI_STRING_NEON)
+  const uint8x16_t low = vdupq_n_u8(0x20);
+  const uint8x16_t high = vdupq_n_u8(0x7E);
+  while (start + 16 <= size) {
+    const uint8x16_t chunk =
+        vld1q_u8(reinterpret_cast<const uint8_t*>(data + start));
+    const uint8x16_t printable =
+        vandq_u8(vcgeq_u8(chunk, low), vcleq_u8(chunk, high));
+    if (vminvq_u8(printable) == 0)
+      break;
+    start += 16;
+  }
+#else
+  constexpr uint64_t kOnes = 0x0101010101010101;
+  constexpr uint64_t kHighBits = 0x8080808080808080;
+  while (start + 8 <= size) {
+    uint64_t word = 0;
+    std::memcpy(&word, data + start, sizeof(word));
+    // Detect the bytes above 0x7F, below 0x20, or equal to 0x7F.
+    const uint64_t del = word ^ (kOnes * 0x7F);  // NOLINT
+    const uint64_t invalid = word | ((word - kOnes * 0x20) & ~word) |  // NOLINT
+                             ((del - kOnes) & ~del);
+    if (invalid & kHighBits)
+      break;
+    start += 8;
+  }
+#endif
+  while (start < size && IsPrintableAscii(data[start]))
+    ++start;
+  return start;
+}
+
 FTXUI_FORCE_INLINE()
 int codepoint_width(uint32_t ucs) {
   if (ftxui::IsControl(ucs))
@@ -1330,6 +1488,9 @@ inline bool EatCodePoint(const std::wstring_view& input,
 
 FTXUI_FORCE_INLINE()
 bool IsCombining(uint32_t ucs) {
+  if (ucs < 0x10000)  // NOLINT
+    return BmpWidthProperties(ucs) & 0b01;
+
   return Bisearch(ucs, g_extend_characters);
 }
 
@@ -1338,6 +1499,9 @@ bool IsFullWidth(uint32_t ucs) {
   if (ucs < 0x0300)  // Quick path: // NOLINT
     return false;
 
+  if (ucs < 0x10000)  // NOLINT
+    return BmpWidthProperties(ucs) & 0b10;
+
   return Bisearch(ucs, g_full_width_characters);
 }
 
@@ -1387,6 +1551,12 @@ int string_width(const std::string_view& input) {
   int width = 0;
   size_t start = 0;
   while (start < input.size()) {
+    const size_t ascii_end = AsciiRunEnd(input, start);
+    width += static_cast<int>(ascii_end - start);
+    start = ascii_end;
+    if (start == input.size())
+      break;
+
     uint32_t codepoint = 0;
     if (!EatCodePoint(input, start, &start, &codepoint))
       continue;
@@ -1413,6 +1583,12 @@ inline std::vector<std::string> Utf8ToGlyphs(const std::string_view& input) {
   size_t start = 0;
   size_t end = 0;
   while (start < input.size()) {
+    const size_t ascii_end = AsciiRunEnd(input, start);
+    for (; start < ascii_end; ++start)
+      out.emplace_back(1, input[start]);
+    if (start == input.size())
+      break;
+
     uint32_t codepoint = 0;
     if (!EatCodePoint(input, start, &end, &codepoint)) {
       start = end;
@@ -1447,6 +1623,56 @@ inline std::vector<std::string> Utf8ToGlyphs(const std::string_view& input) {
   return out;
 }
 
+inline std::vector<GlyphSpan> Utf8ToGlyphSpans(const std::string_view& input,
+                                               bool* complete) {
+  std::vector<GlyphSpan> out;
+  out.reserve(input.size());
+  size_t start = 0;
+  size_t end = 0;
+  while (start < input.size()) {
+    const size_t ascii_end = AsciiRunEnd(input, start);
+    for (; start < ascii_end; ++start)
+      out.push_back({static_cast<uint32_t>(start), 1});
+    if (start == input.size())
+      break;
+
+    uint32_t codepoint = 0;
+    if (!EatCodePoint(input, start, &end, &codepoint)) {
+      start = end;
+      continue;
+    }
+
+    const GlyphSpan span = {static_cast<uint32_t>(start),
+                            static_cast<uint32_t>(end - start)};
+    start = end;
+
+    // Ignore control characters.
+    if (IsControl(codepoint))
+      continue;
+
+    // Combining characters are put with the previous glyph they are modifying.
+    // The span can only grow over contiguous bytes, so they are dropped after
+    // an ignored control character.
+    if (IsCombining(codepoint)) {
+      if (out.empty())
+        continue;
+      if (out.back().offset + out.back().size == span.offset)
+        out.back().size += span.size;
+      else if (complete)
+        *complete = false;
+      continue;
+    }
+
+    out.push_back(span);
+
+    // Fullwidth characters take two cells. The second is empty, to reserve the
+    // space the first is taking.
+    if (IsFullWidth(codepoint))
+      out.push_back({static_cast<uint32_t>(end), 0});
+  }
+  return out;
+}
+
 FTXUI_FORCE_INLINE()
 size_t GlyphPrevious(const std::string_view& input, size_t start) {
   while (true) {
@@ -1473,6 +1699,12 @@ size_t GlyphPrevious(const std::string_view& input, size_t start) {
 
 FTXUI_FORCE_INLINE()
 size_t GlyphNext(const std::string_view& input, size_t start) {
+  // Two printable ASCII characters are two glyphs.
+  if (start + 1 < input.size() && IsPrintableAscii(input[start]) &&
+      IsPrintableAscii(input[start + 1])) {
+    return start + 1;
+  }
+
   bool glyph_found = false;
   while (start < input.size()) {
     size_t end = 0;
@@ -1519,6 +1751,12 @@ inline std::vector<int> CellToGlyphIndex(const std::string_view& input) {
   size_t start = 0;
   size_t end = 0;
   while (start < input.size()) {
+    const size_t ascii_end = AsciiRunEnd(input, start);
+    for (; start < ascii_end; ++start)
+      out.push_back(++x);
+    if (start == input.size())
+      break;
+
     uint32_t codepoint = 0;
     const bool eaten = EatCodePoint(input, start, &end, &codepoint);
     start = end;
@@ -1558,6 +1796,12 @@ int GlyphCount(const std::string_view& input) {
   size_t start = 0;
   size_t end = 0;
   while (start < input.size()) {
+    const size_t ascii_end = AsciiRunEnd(input, start);
+    size += static_cast<int>(ascii_end - start);
+    start = ascii_end;
+    if (start == input.size())
+      break;
+
     uint32_t codepoint = 0;
     const bool eaten = EatCodePoint(input, start, &end, &codepoint);
     start = end;
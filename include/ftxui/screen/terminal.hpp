@@ -12,6 +12,9 @@ struct Dimensions {
 
 namespace Terminal {
 Dimensions Size();
+Dimensions RefreshSize();
+void CacheSize(bool enabled);
+bool SizeCached();
 void SetFallbackSize(const Dimensions& fallbackSize);
 
 enum Color {
@@ -0,0 +1,258 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <benchmark/benchmark.h>
+#include <cstdint>     // for int64_t
+#include <functional>  // for function
+#include <string>      // for string
+#include <thread>      // for thread
+#include <vector>      // for vector
+
+#include "ftxui/component/component.hpp"       // for Input, Checkbox, Make, Menu, Radiobox, Renderer, Vertical, Horizontal
+#include "ftxui/component/component_base.hpp"  // for ComponentBase
+#include "ftxui/component/component_options.hpp"  // for InputOption, MenuOption, RadioboxOption
+#include "ftxui/component/event.hpp"              // for Event
+#include "ftxui/component/hit_map.hpp"            // for HitMap
+#include "ftxui/component/mouse.hpp"              // for Mouse
+#include "ftxui/component/receiver.hpp"  // for MakeReceiver, Sender
+#include "ftxui/component/task.hpp"      // for Task
+#include "ftxui/component/terminal_input_parser.hpp"  // for TerminalInputParser
+#include "ftxui/dom/elements.hpp"   // for text, vbox, frame, Elements
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+// Post closures from |state.range(0)| threads, run by a single consumer, like
+// background workers updating a model through ScreenInteractive::Post().
+static void BenchmarkReceiverThroughput(benchmark::State& state) {
+  using Closure = std::function<void()>;
+  const int producers = state.range(0);
+  const int count = 1 << 16;
+  for (auto _ : state) {
+    auto receiver = MakeReceiver<Closure>();
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+      threads.emplace_back(
+          [count = count / producers](Sender<Closure> sender) {
+            for (int i = 0; i < count; ++i) {
+              sender->Send([i] { benchmark::DoNotOptimize(i); });
+            }
+          },
+          receiver->MakeSender());
+    }
+    Closure closure;
+    while (receiver->Receive(&closure)) {
+      closure();
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BenchmarkReceiverThroughput)
+    ->Arg(1)
+    ->Arg(4)
+    ->Arg(16)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+// Type a character in the middle of a multi-line input holding
+// |state.range(0)| bytes, and draw the next frame.
+static void BenchmarkInputTyping(benchmark::State& state) {
+  std::string content;
+  while (content.size() < static_cast<size_t>(state.range(0))) {
+    content += "The quick brown fox jumps over the lazy dog, line " +
+               std::to_string(content.size()) + "\n";
+  }
+  int cursor_position = static_cast<int>(content.size() / 2);
+  auto input = Input({
+      .content = &content,
+      .virtualized = state.range(1) != 0,
+      .cursor_position = &cursor_position,
+  });
+  Screen screen(80, 24);
+  for (auto _ : state) {
+    input->OnEvent(Event::Character('a'));
+    screen.Clear();
+    Render(screen, input->Render());
+  }
+  state.SetLabel(state.range(1) ? "virtualized" : "default");
+}
+BENCHMARK(BenchmarkInputTyping)
+    ->ArgsProduct({{10'000, 1'000'000, 10'000'000}, {0, 1}})
+    ->Unit(benchmark::kMicrosecond);
+
+// Parse |state.range(0)| bytes read from the terminal: a paste of text, a
+// single long OSC sequence, or a bracketed paste. The bytes are added one by
+// one, or at once.
+static void BenchmarkTerminalInputParser(benchmark::State& state) {
+  const size_t size = static_cast<size_t>(state.range(0));
+  const int kind = static_cast<int>(state.range(1));
+  const bool bulk = state.range(2) != 0;
+  std::string text;
+  while (text.size() < size) {
+    text += "The quick brown fox jumps over the lazy dog, \xC3\xA9t\xC3\xA9\r";
+  }
+  const char* const labels[] = {"text", "osc", "bracketed paste"};
+  std::string input = text;
+  if (kind == 1) {
+    input = "\x1B]52;c;" + std::string(size, 'a') + "\x1B\\";
+  }
+  if (kind == 2) {
+    input = "\x1B[200~" + text + "\x1B[201~";
+  }
+  for (auto _ : state) {
+    auto receiver = MakeReceiver<Task>();
+    {
+      TerminalInputParser parser(receiver->MakeSender());
+      if (bulk) {
+        parser.Add(input);
+      } else {
+        for (char c : input) {
+          parser.Add(c);
+        }
+      }
+    }
+    Task task;
+    while (receiver->Receive(&task)) {
+      benchmark::DoNotOptimize(task);
+    }
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(input.size()));
+  state.SetLabel(std::string(labels[kind]) + (bulk ? ", bulk" : ""));
+}
+BENCHMARK(BenchmarkTerminalInputParser)
+    ->ArgsProduct({{100'000}, {0, 1, 2}, {0, 1}})
+    ->Unit(benchmark::kMicrosecond);
+
+// Draw a tree |state.range(0)| levels deep and 50 wide: each level holds 49
+// labels, then the next level. Finding the active child of a level scans its
+// children, and asks whether their subtree is Focusable(). With or without the
+// FocusScope ScreenInteractive uses.
+static void BenchmarkFocusTree(benchmark::State& state) {
+  // Use the default ActiveChild().
+  class Level : public ComponentBase {
+    Element OnRender() override {
+      Elements elements;
+      for (auto& child : children_) {
+        elements.push_back(child->Render());
+      }
+      return vbox(std::move(elements));
+    }
+  };
+  const int depth = static_cast<int>(state.range(0));
+  const bool scope = state.range(1) != 0;
+  bool checked = false;
+  Component root = Make<Level>();
+  Component level = root;
+  for (int i = 0; i < depth; ++i) {
+    for (int j = 1; j < 50; ++j) {
+      level->Add(Renderer([] { return text("label"); }));
+    }
+    Component next = Make<Level>();
+    level->Add(next);
+    level = next;
+  }
+  for (int j = 0; j < 50; ++j) {
+    level->Add(Checkbox("checkbox", &checked));
+  }
+  for (auto _ : state) {
+    if (scope) {
+      const ComponentBase::FocusScope focus_scope;
+      benchmark::DoNotOptimize(root->Render());
+    } else {
+      benchmark::DoNotOptimize(root->Render());
+    }
+  }
+  state.SetLabel(scope ? "focus scope" : "default");
+}
+BENCHMARK(BenchmarkFocusTree)
+    ->ArgsProduct({{10}, {0, 1}})
+    ->Unit(benchmark::kMicrosecond);
+
+// Move the mouse over 10,000 checkboxes, 100 rows of 100. With or without the
+// HitMap ScreenInteractive uses to route the mouse events.
+static void BenchmarkMouseMove(benchmark::State& state) {
+  const bool hit_map = state.range(0) != 0;
+  bool checked = false;
+  auto rows = Container::Vertical({});
+  for (int y = 0; y < 100; ++y) {
+    auto row = Container::Horizontal({});
+    for (int x = 0; x < 100; ++x) {
+      row->Add(Checkbox("", &checked));
+    }
+    rows->Add(row);
+  }
+
+  HitMap map;
+  Screen screen(500, 100);
+  {
+    const HitMap::Scope scope(&map);
+    Render(screen, rows->Render());
+  }
+  map.Paint(500, 100);
+
+  Mouse mouse;
+  mouse.button = Mouse::None;
+  mouse.motion = Mouse::Moved;
+  int i = 0;
+  for (auto _ : state) {
+    mouse.x = (i * 7) % 500;
+    mouse.y = (i * 3) % 100;
+    ++i;
+    const Event event = Event::Mouse("", mouse);
+    if (hit_map) {
+      map.Route(mouse.x, mouse.y);
+      const HitMap::RouteScope route(&map);
+      benchmark::DoNotOptimize(rows->OnEvent(event));
+    } else {
+      benchmark::DoNotOptimize(rows->OnEvent(event));
+    }
+  }
+  state.SetLabel(hit_map ? "hit map" : "default");
+}
+BENCHMARK(BenchmarkMouseMove)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
+// Move the selection of a menu or a radiobox of 1,000,000 entries, and draw the
+// next frame: in a frame, or virtualized.
+static void BenchmarkMenu(benchmark::State& state) {
+  const bool virtualized = state.range(1) != 0;
+  std::vector<std::string> entries;
+  entries.reserve(1'000'000);
+  for (int i = 0; i < 1'000'000; ++i) {
+    entries.push_back("Entry " + std::to_string(i));
+  }
+  int selected = 500'000;
+  Component component;
+  if (state.range(0) == 0) {
+    component = Menu({
+        .entries = &entries,
+        .selected = &selected,
+        .virtualized = virtualized,
+    });
+  } else {
+    component = Radiobox({
+        .entries = &entries,
+        .selected = &selected,
+        .virtualized = virtualized,
+    });
+  }
+  Screen screen(80, 24);
+  int i = 0;
+  for (auto _ : state) {
+    component->OnEvent(++i % 2 ? Event::ArrowDown : Event::ArrowUp);
+    screen.Clear();
+    Element element = component->Render();
+    Render(screen, virtualized ? element : element | frame);
+  }
+  state.SetLabel(std::string(state.range(0) ? "radiobox" : "menu") +
+                 (virtualized ? " virtualized" : " default"));
+}
+BENCHMARK(BenchmarkMenu)
+    ->ArgsProduct({{0, 1}, {0, 1}})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace ftxui
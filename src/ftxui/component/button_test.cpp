@@ -9,6 +9,7 @@
 #include "ftxui/component/component_options.hpp"  // for ButtonOption
 #include "ftxui/component/event.hpp"  // for Event, Event::Return, Event::ArrowLeft, Event::ArrowRight
 #include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::Left, Mouse::Pressed
+#include "ftxui/dom/elements.hpp"     // for frame, size, text, vbox, EQUAL, HEIGHT
 #include "ftxui/dom/node.hpp"         // for Render
 #include "ftxui/screen/screen.hpp"    // for Screen
 #include "ftxui/screen/terminal.hpp"  // for SetColorSupport, Color, TrueColor
@@ -126,22 +127,22 @@ TEST(ButtonTest, Animation) {
     Screen screen(12, 3);
     Render(screen, container->Render());
     EXPECT_EQ(screen.ToString(),
-              "\x1B[1m\x1B[38;2;191;191;191m\x1B[48;2;0;0;0m      \x1B[22m     "
-              " \x1B[39m\x1B[49m\r\n\x1B[1m\x1B[38;2;191;191;191m\x1B[48;2;0;0;"
-              "0m btn1 \x1B[22m btn2 "
-              "\x1B[39m\x1B[49m\r\n\x1B[1m\x1B[38;2;191;191;191m\x1B[48;2;0;0;"
-              "0m      \x1B[22m      \x1B[39m\x1B[49m");
+              "\x1B[1;38;2;191;191;191;48;2;0;0;0m      \x1B[22m      \x1B[0m"
+              "\r\n"
+              "\x1B[1;38;2;191;191;191;48;2;0;0;0m btn1 \x1B[22m btn2 \x1B[0m"
+              "\r\n"
+              "\x1B[1;38;2;191;191;191;48;2;0;0;0m      \x1B[22m      \x1B[0m");
   }
   selected = 1;
   {
     Screen screen(12, 3);
     Render(screen, container->Render());
     EXPECT_EQ(screen.ToString(),
-              "\x1B[38;2;191;191;191m\x1B[48;2;0;0;0m      \x1B[1m      "
-              "\x1B[22m\x1B[39m\x1B[49m\r\n\x1B[38;2;191;191;191m\x1B[48;2;0;0;"
-              "0m btn1 \x1B[1m btn2 "
-              "\x1B[22m\x1B[39m\x1B[49m\r\n\x1B[38;2;191;191;191m\x1B[48;2;0;0;"
-              "0m      \x1B[1m      \x1B[22m\x1B[39m\x1B[49m");
+              "\x1B[38;2;191;191;191;48;2;0;0;0m      \x1B[1m      \x1B[0m"
+              "\r\n"
+              "\x1B[38;2;191;191;191;48;2;0;0;0m btn1 \x1B[1m btn2 \x1B[0m"
+              "\r\n"
+              "\x1B[38;2;191;191;191;48;2;0;0;0m      \x1B[1m      \x1B[0m");
   }
   animation::Params params(2s);
   container->OnAnimation(params);
@@ -150,13 +151,12 @@ TEST(ButtonTest, Animation) {
     Render(screen, container->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[38;2;191;191;191m\x1B[48;2;0;0;0m      "
-        "\x1B[1m\x1B[38;2;254;254;254m\x1B[48;2;127;127;127m      "
-        "\x1B[22m\x1B[39m\x1B[49m\r\n\x1B[38;2;191;191;191m\x1B[48;2;0;0;0m "
-        "btn1 \x1B[1m\x1B[38;2;254;254;254m\x1B[48;2;127;127;127m btn2 "
-        "\x1B[22m\x1B[39m\x1B[49m\r\n\x1B[38;2;191;191;191m\x1B[48;2;0;0;0m    "
-        "  \x1B[1m\x1B[38;2;254;254;254m\x1B[48;2;127;127;127m      "
-        "\x1B[22m\x1B[39m\x1B[49m");
+        "\x1B[38;2;191;191;191;48;2;0;0;0m      "
+        "\x1B[1;38;2;254;254;254;48;2;127;127;127m      \x1B[0m\r\n"
+        "\x1B[38;2;191;191;191;48;2;0;0;0m btn1 "
+        "\x1B[1;38;2;254;254;254;48;2;127;127;127m btn2 \x1B[0m\r\n"
+        "\x1B[38;2;191;191;191;48;2;0;0;0m      "
+        "\x1B[1;38;2;254;254;254;48;2;127;127;127m      \x1B[0m");
   }
   EXPECT_EQ(selected, 1);
   container->OnEvent(MousePressed(3, 1));
@@ -166,13 +166,12 @@ TEST(ButtonTest, Animation) {
     Render(screen, container->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[1m\x1B[38;2;226;226;226m\x1B[48;2;93;93;93m      "
-        "\x1B[22m\x1B[38;2;254;254;254m\x1B[48;2;127;127;127m      "
-        "\x1B[39m\x1B[49m\r\n\x1B[1m\x1B[38;2;226;226;226m\x1B[48;2;93;93;93m "
-        "btn1 \x1B[22m\x1B[38;2;254;254;254m\x1B[48;2;127;127;127m btn2 "
-        "\x1B[39m\x1B[49m\r\n\x1B[1m\x1B[38;2;226;226;226m\x1B[48;2;93;93;93m  "
-        "    \x1B[22m\x1B[38;2;254;254;254m\x1B[48;2;127;127;127m      "
-        "\x1B[39m\x1B[49m");
+        "\x1B[1;38;2;226;226;226;48;2;93;93;93m      "
+        "\x1B[22;38;2;254;254;254;48;2;127;127;127m      \x1B[0m\r\n"
+        "\x1B[1;38;2;226;226;226;48;2;93;93;93m btn1 "
+        "\x1B[22;38;2;254;254;254;48;2;127;127;127m btn2 \x1B[0m\r\n"
+        "\x1B[1;38;2;226;226;226;48;2;93;93;93m      "
+        "\x1B[22;38;2;254;254;254;48;2;127;127;127m      \x1B[0m");
   }
   container->OnAnimation(params);
   {
@@ -180,15 +179,42 @@ TEST(ButtonTest, Animation) {
     Render(screen, container->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[1m\x1B[38;2;254;254;254m\x1B[48;2;127;127;127m      "
-        "\x1B[22m\x1B[38;2;191;191;191m\x1B[48;2;0;0;0m      "
-        "\x1B[39m\x1B[49m\r\n\x1B[1m\x1B[38;2;254;254;254m\x1B[48;2;127;127;"
-        "127m btn1 \x1B[22m\x1B[38;2;191;191;191m\x1B[48;2;0;0;0m btn2 "
-        "\x1B[39m\x1B[49m\r\n\x1B[1m\x1B[38;2;254;254;254m\x1B[48;2;127;127;"
-        "127m      \x1B[22m\x1B[38;2;191;191;191m\x1B[48;2;0;0;0m      "
-        "\x1B[39m\x1B[49m");
+        "\x1B[1;38;2;254;254;254;48;2;127;127;127m      "
+        "\x1B[22;38;2;191;191;191;48;2;0;0;0m      \x1B[0m\r\n"
+        "\x1B[1;38;2;254;254;254;48;2;127;127;127m btn1 "
+        "\x1B[22;38;2;191;191;191;48;2;0;0;0m btn2 \x1B[0m\r\n"
+        "\x1B[1;38;2;254;254;254;48;2;127;127;127m      "
+        "\x1B[22;38;2;191;191;191;48;2;0;0;0m      \x1B[0m");
   }
 }
 
+TEST(ButtonTest, ClickNextToFrame) {
+  std::string last_press;
+  auto container = Container::Vertical({});
+  for (int i = 0; i < 10; ++i) {
+    const std::string label = "b" + std::to_string(i);
+    container->Add(Button(
+        label, [&, label] { last_press = label; }, ButtonOption::Ascii()));
+  }
+
+  auto document = vbox({
+      container->Render() | frame | size(HEIGHT, EQUAL, 3),
+      text("below1"),
+      text("below2"),
+      text("below3"),
+  });
+  Screen screen(20, 10);
+  Render(screen, document);
+
+  // The buttons scrolled out of the frame must not receive clicks.
+  for (int y = 3; y < 10; ++y) {
+    container->OnEvent(MousePressed(1, y));
+  }
+  EXPECT_EQ(last_press, "");
+
+  container->OnEvent(MousePressed(1, 1));
+  EXPECT_EQ(last_press, "b1");
+}
+
 }  // namespace ftxui
 // NOLINTEND
@@ -4,6 +4,7 @@
 #include <algorithm>  // for find_if
 #include <cassert>    // for assert
 #include <cstddef>    // for size_t
+#include <cstdint>    // for uint64_t
 #include <iterator>   // for begin, end
 #include <memory>     // for unique_ptr, make_unique
 #include <utility>    // for move
@@ -13,10 +14,13 @@
 #include "ftxui/component/component.hpp"
 #include "ftxui/component/component_base.hpp"  // for ComponentBase, Components
 #include "ftxui/component/event.hpp"           // for Event
+#include "ftxui/component/hit_map.hpp"         // for HitMap
 #include "ftxui/component/screen_interactive.hpp"  // for Component, ScreenInteractive
 #include "ftxui/dom/elements.hpp"                  // for text, Element
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
 #include "ftxui/dom/node.hpp"                      // for Node, Elements
 #include "ftxui/screen/box.hpp"                    // for Box
+#include "ftxui/screen/screen.hpp"                 // for Screen
 
 namespace ftxui::animation {
 class Params;
@@ -26,6 +30,17 @@ namespace ftxui {
 
 namespace {
 class CaptureMouseImpl : public CapturedMouseInterface {};
+
+// The generation of the focus cache of the current thread. 0 when no
+// FocusScope is alive.
+thread_local uint64_t g_focus_generation = 0;       // NOLINT
+thread_local uint64_t g_focus_last_generation = 0;  // NOLINT
+
+void InvalidateFocusCache() {
+  if (g_focus_generation != 0) {
+    g_focus_generation = ++g_focus_last_generation;
+  }
+}
 }  // namespace
 
 ComponentBase::~ComponentBase() {
@@ -76,6 +91,7 @@ void ComponentBase::Add(Component child) {
   child->Detach();
   child->parent_ = this;
   children_.push_back(std::move(child));
+  InvalidateFocusCache();
 }
 
 /// @brief Detach this child from its parent.
@@ -93,6 +109,7 @@ void ComponentBase::Detach() {
                          });
   ComponentBase* parent = parent_;
   parent_ = nullptr;
+  InvalidateFocusCache();
   parent->children_.erase(it);  // Might delete |this|.
 }
 
@@ -115,6 +132,13 @@ Element ComponentBase::Render() {
     return ComponentBase::OnRender();
   }
 
+  // Record the component, and where its element is drawn.
+  HitMap* hit_map = HitMap::Current();
+  const int record =
+      hit_map ? hit_map->Open(this, parent_,
+                              parent_ ? &parent_->children_ : nullptr)
+              : -1;
+
   in_render = true;
   Element element = OnRender();
   in_render = false;
@@ -122,22 +146,36 @@ Element ComponentBase::Render() {
   class Wrapper : public Node {
    public:
     bool active_ = false;
+    bool hit_test_ = false;
+    HitMap::Drawn drawn_;
 
     Wrapper(Element child, bool active)
         : Node({std::move(child)}), active_(active) {}
 
     void SetBox(Box box) override {
       Node::SetBox(box);
-      children_[0]->SetBox(box);
+      children_[0]->SetBoxCached(box);
     }
 
     void ComputeRequirement() override {
       Node::ComputeRequirement();
       requirement_.focused.component_active = active_;
     }
+
+    void Render(Screen& screen) override {
+      if (hit_test_) {
+        drawn_.Draw(Box::Intersection(box_, screen.stencil));
+      }
+      Node::Render(screen);
+    }
   };
 
-  return std::make_shared<Wrapper>(std::move(element), Active());
+  auto wrapper = MakeNode<Wrapper>(std::move(element), Active());
+  if (hit_map) {
+    wrapper->hit_test_ = true;
+    hit_map->Close(record, wrapper, &wrapper->drawn_);
+  }
+  return wrapper;
 }
 
 /// @brief Draw the component.
@@ -159,7 +197,29 @@ Element ComponentBase::OnRender() {
 /// true. If none returns true, return false.
 /// @ingroup component
 bool ComponentBase::OnEvent(Event event) {  // NOLINT
-  for (Component& child : children_) {      // NOLINT
+  // Deliver the mouse events only to the children under the mouse, or under
+  // it at the previous event, when ScreenInteractive routes them.
+  if (const HitMap* hit_map = event.is_mouse() ? HitMap::Routing() : nullptr) {
+    HitMap::Step steps[2];
+    const int count = hit_map->Children(this, children_, event.mouse().x,
+                                        event.mouse().y, steps);
+    if (count != -1) {
+      for (int i = 0; i < count; ++i) {
+        // The first child may have modified the children.
+        if (steps[i].index >= children_.size() ||
+            children_[steps[i].index].get() != steps[i].component) {
+          continue;
+        }
+        const Component child = children_[steps[i].index];
+        if (child->OnEvent(event)) {
+          return true;
+        }
+      }
+      return false;
+    }
+  }
+
+  for (Component& child : children_) {  // NOLINT
     if (child->OnEvent(event)) {
       return true;
     }
@@ -205,7 +265,11 @@ bool ComponentBase::Focusable() const {
 /// @brief Returns if the element if the currently active child of its parent.
 /// @ingroup component
 bool ComponentBase::Active() const {
-  return parent_ == nullptr || parent_->ActiveChild().get() == this;
+  if (g_focus_generation == 0) {
+    return parent_ == nullptr || parent_->ActiveChild().get() == this;
+  }
+  UpdateFocusCache();
+  return active_;
 }
 
 /// @brief Returns if the elements if focused by the user.
@@ -214,11 +278,46 @@ bool ComponentBase::Active() const {
 /// Focusable().
 /// @ingroup component
 bool ComponentBase::Focused() const {
-  const auto* current = this;
-  while (current && current->Active()) {
-    current = current->parent_;
+  if (g_focus_generation == 0) {
+    const auto* current = this;
+    while (current && current->Active()) {
+      current = current->parent_;
+    }
+    return !current && Focusable();
+  }
+  UpdateFocusCache();
+  return ancestors_active_ && Focusable();
+}
+
+// Compute Active(), and whether the ancestors are active too, once per
+// generation of the FocusScope. The parent computes its ActiveChild() once, for
+// all its children.
+void ComponentBase::UpdateFocusCache() const {
+  if (focus_generation_ == g_focus_generation) {
+    return;
   }
-  return !current && Focusable();
+  focus_generation_ = g_focus_generation;
+  active_child_known_ = false;
+  active_ = true;
+  ancestors_active_ = true;
+  if (parent_) {
+    parent_->UpdateFocusCache();
+    if (!parent_->active_child_known_) {
+      parent_->active_child_ = parent_->ActiveChild().get();
+      parent_->active_child_known_ = true;
+    }
+    active_ = parent_->active_child_ == this;
+    ancestors_active_ = active_ && parent_->ancestors_active_;
+  }
+}
+
+ComponentBase::FocusScope::FocusScope() : previous_(g_focus_generation) {
+  g_focus_generation = ++g_focus_last_generation;
+}
+
+ComponentBase::FocusScope::~FocusScope() {
+  // The outer scope, if any, may have seen the components change.
+  g_focus_generation = previous_ == 0 ? 0 : ++g_focus_last_generation;
 }
 
 /// @brief Make the |child| to be the "active" one.
@@ -231,6 +330,7 @@ void ComponentBase::SetActiveChild([[maybe_unused]] ComponentBase* child) {}
 /// @ingroup component
 void ComponentBase::SetActiveChild(Component child) {  // NOLINT
   SetActiveChild(child.get());
+  InvalidateFocusCache();
 }
 
 /// @brief Configure all the ancestors to give focus to this component.
@@ -241,6 +341,7 @@ void ComponentBase::TakeFocus() {
     parent->SetActiveChild(child);
     child = parent;
   }
+  InvalidateFocusCache();
 }
 
 /// @brief Take the CapturedMouse if available. There is only one component of
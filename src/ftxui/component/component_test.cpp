@@ -172,4 +172,66 @@ TEST(ComponentTest, NonFocusableAreNotFocused) {
   EXPECT_EQ(child->ActiveChild(), nullptr);
 }
 
+TEST(ComponentTest, FocusScope) {
+  class Leaf : public ComponentBase {
+    bool Focusable() const override { return true; }
+  };
+  // root
+  // ├── a
+  // │   ├── a_1
+  // │   └── a_2
+  // └── b
+  auto root = Container::Vertical({});
+  auto a = Container::Vertical({});
+  auto a_1 = Make<Leaf>();
+  auto a_2 = Make<Leaf>();
+  auto b = Make<Leaf>();
+  root->Add(a);
+  root->Add(b);
+  a->Add(a_1);
+  a->Add(a_2);
+  const Component all[] = {root, a, a_1, a_2, b};
+
+  const auto check = [&] {
+    bool active[5];
+    bool focused[5];
+    for (int i = 0; i < 5; ++i) {
+      active[i] = all[i]->Active();
+      focused[i] = all[i]->Focused();
+    }
+    const ComponentBase::FocusScope scope;
+    for (int i = 0; i < 5; ++i) {
+      EXPECT_EQ(all[i]->Active(), active[i]);
+      EXPECT_EQ(all[i]->Focused(), focused[i]);
+    }
+  };
+  check();
+  EXPECT_TRUE(a_1->Focused());
+
+  {
+    const ComponentBase::FocusScope scope;
+    EXPECT_TRUE(a_1->Focused());
+    EXPECT_FALSE(b->Focused());
+
+    // Changing the focus invalidates the cache.
+    b->TakeFocus();
+    EXPECT_FALSE(a_1->Focused());
+    EXPECT_TRUE(b->Focused());
+
+    a_2->TakeFocus();
+    EXPECT_FALSE(b->Focused());
+    EXPECT_TRUE(a_2->Focused());
+    EXPECT_TRUE(a->Active());
+    EXPECT_FALSE(a_1->Active());
+
+    a_2->Detach();
+    EXPECT_TRUE(a_1->Focused());
+  }
+  check();
+
+  root->SetActiveChild(b);
+  check();
+  EXPECT_TRUE(b->Focused());
+}
+
 }  // namespace ftxui
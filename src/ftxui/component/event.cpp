@@ -3,7 +3,8 @@
 // the LICENSE file.
 #include <map>  // for map
 #include <string>
-#include <utility>  // for move
+#include <string_view>  // for string_view
+#include <utility>      // for move
 
 #include "ftxui/component/event.hpp"
 #include "ftxui/component/mouse.hpp"  // for Mouse
@@ -62,6 +63,34 @@ Event Event::Mouse(std::string input, struct Mouse mouse) {
   return event;
 }
 
+/// @brief An event corresponding to a text pasted in the terminal, at once.
+/// @param text The text pasted.
+/// @ingroup component
+///
+/// When the terminal supports bracketed paste, the pasted text is received as
+/// a single event, instead of one event per character. Its input is the text
+/// surrounded by the bracketed paste markers, so that it can't be mistaken
+/// for a key.
+// static
+Event Event::Paste(std::string_view text) {
+  Event event;
+  event.input_.reserve(text.size() + 12);  // NOLINT
+  event.input_ = "\x1B[200~";
+  event.input_ += text;
+  event.input_ += "\x1B[201~";
+  event.type_ = Type::Paste;
+  return event;
+}
+
+/// @brief The text pasted, when is_paste().
+std::string_view Event::paste() const {
+  const size_t marker = 6;
+  if (type_ != Type::Paste || input_.size() < 2 * marker) {
+    return {};
+  }
+  return std::string_view(input_).substr(marker, input_.size() - 2 * marker);
+}
+
 /// @brief An event corresponding to a terminal DCS (Device Control String).
 // static
 Event Event::CursorShape(std::string input, int shape) {
@@ -266,6 +295,8 @@ std::string Event::DebugString() const {
       out += "})";
       return out;
     }
+    case Type::Paste:
+      return "Event::Paste(" + std::to_string(paste().size()) + " bytes)";
     case Type::CursorShape:
       return "Event::CursorShape(" + input_ + ", " +
              std::to_string(data_.cursor_shape) + ")";
@@ -0,0 +1,126 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/component/frame_profiler.hpp"
+
+#include <algorithm>  // for max
+#include <chrono>     // for duration_cast, microseconds
+#include <string>     // for string, to_string
+#include <utility>    // for move
+
+#include "ftxui/dom/elements.hpp"  // for text, gridbox, vbox, window, Element
+
+namespace ftxui {
+
+namespace {
+
+using Duration = FrameProfile::Duration;
+
+struct Phase {
+  const char* name;
+  Duration (*get)(const FrameProfile&);
+};
+
+// clang-format off
+const Phase kPhases[] = {
+  {"tasks",     [](const FrameProfile& p) { return p.tasks; }},
+  {"component", [](const FrameProfile& p) { return p.component; }},
+  {"layout",    [](const FrameProfile& p) { return p.render.layout; }},
+  {"select",    [](const FrameProfile& p) { return p.render.select; }},
+  {"render",    [](const FrameProfile& p) { return p.render.render; }},
+  {"shader",    [](const FrameProfile& p) { return p.render.shader; }},
+  {"serialize", [](const FrameProfile& p) { return p.serialize; }},
+  {"output",    [](const FrameProfile& p) { return p.output; }},
+  {"total",     [](const FrameProfile& p) { return p.total; }},
+};
+// clang-format on
+
+// Format a duration as milliseconds, with two decimals.
+std::string Format(Duration duration) {
+  const auto us =
+      std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+  const auto hundredths = us % 1000 / 10;
+  return std::to_string(us / 1000) + (hundredths < 10 ? ".0" : ".") +
+         std::to_string(hundredths) + "ms";
+}
+
+}  // namespace
+
+/// @brief Keep the profiles of the last |capacity| frames.
+FrameProfiler::FrameProfiler(size_t capacity)
+    : frames_(std::max(capacity, size_t(1))) {}
+
+/// @brief Add the profile of a frame, replacing the oldest one once full.
+void FrameProfiler::Record(const FrameProfile& profile) {
+  frames_[next_] = profile;
+  next_ = (next_ + 1) % frames_.size();
+  size_ = std::min(size_ + 1, frames_.size());
+  if (on_frame_) {
+    on_frame_(profile);
+  }
+}
+
+/// @brief The i-th profile kept, from the oldest one.
+const FrameProfile& FrameProfiler::operator[](size_t i) const {
+  return frames_[(next_ + frames_.size() - size_ + i) % frames_.size()];
+}
+
+/// @brief Call |callback| with every profile recorded, right after the frame
+/// was drawn.
+void FrameProfiler::OnFrame(std::function<void(const FrameProfile&)> callback) {
+  on_frame_ = std::move(callback);
+}
+
+/// @brief An element displaying the last profile, and the average and worst
+/// ones among those kept.
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::Fullscreen();
+/// screen.EnableProfiler();
+/// auto renderer = Renderer(component, [&] {
+///   return hbox({
+///     component->Render() | flex,
+///     screen.Profiler()->Overlay(),
+///   });
+/// });
+/// ```
+Element FrameProfiler::Overlay() const {
+  if (empty()) {
+    return window(text("profiler"), text("no frame"));
+  }
+
+  std::vector<Elements> lines;
+  lines.push_back({text(""), text(" last"), text(" avg"), text(" max")});
+  for (const Phase& phase : kPhases) {
+    Duration sum{};
+    Duration worst{};
+    for (size_t i = 0; i < size_; ++i) {
+      const Duration duration = phase.get((*this)[i]);
+      sum += duration;
+      worst = std::max(worst, duration);
+    }
+    lines.push_back({
+        text(phase.name),
+        text(" " + Format(phase.get(back()))),
+        text(" " + Format(sum / static_cast<int>(size_))),
+        text(" " + Format(worst)),
+    });
+  }
+
+  const FrameProfile& last = back();
+  return window(text("frame " + std::to_string(last.frame)),
+                vbox({
+                    gridbox(std::move(lines)),
+                    text(std::to_string(last.tasks_handled) + " tasks, " +
+                         std::to_string(last.render.layout_iterations) +
+                         " layout iterations"),
+                    text(std::to_string(last.render.nodes) + " nodes, " +
+                         std::to_string(last.render.nodes_laid_out) +
+                         " laid out"),
+                    text(std::to_string(last.bytes) + " bytes"),
+                }));
+}
+
+}  // namespace ftxui
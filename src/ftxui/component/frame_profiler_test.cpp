@@ -0,0 +1,97 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>  // for string
+
+#include "ftxui/component/component.hpp"       // for Renderer
+#include "ftxui/component/event.hpp"           // for Event
+#include "ftxui/component/frame_profiler.hpp"  // for FrameProfiler
+#include "ftxui/component/loop.hpp"            // for Loop
+#include "ftxui/component/screen_interactive.hpp"
+#include "ftxui/dom/elements.hpp"  // for text, hbox
+#include "ftxui/dom/node.hpp"      // for Render
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(FrameProfilerTest, RingBuffer) {
+  FrameProfiler profiler(3);
+  EXPECT_TRUE(profiler.empty());
+  EXPECT_EQ(profiler.capacity(), 3u);
+
+  size_t called = 0;
+  profiler.OnFrame([&](const FrameProfile& profile) {
+    EXPECT_EQ(profile.frame, ++called);
+  });
+
+  for (size_t frame = 1; frame <= 5; ++frame) {
+    FrameProfile profile;
+    profile.frame = frame;
+    profiler.Record(profile);
+  }
+  EXPECT_EQ(called, 5u);
+
+  // Only the last 3 frames are kept, from the oldest.
+  ASSERT_EQ(profiler.size(), 3u);
+  EXPECT_EQ(profiler[0].frame, 3u);
+  EXPECT_EQ(profiler[1].frame, 4u);
+  EXPECT_EQ(profiler[2].frame, 5u);
+  EXPECT_EQ(profiler.back().frame, 5u);
+}
+
+TEST(FrameProfilerTest, Overlay) {
+  FrameProfiler profiler(4);
+  FrameProfile profile;
+  profile.frame = 42;
+  profile.total = std::chrono::microseconds(1500);
+  profile.render.nodes = 12;
+  profiler.Record(profile);
+
+  Screen screen(40, 16);
+  Render(screen, profiler.Overlay());
+  const std::string output = screen.ToString();
+  EXPECT_NE(output.find("frame 42"), std::string::npos);
+  EXPECT_NE(output.find("1.50ms"), std::string::npos);
+  EXPECT_NE(output.find("12 nodes"), std::string::npos);
+}
+
+TEST(FrameProfilerTest, ScreenInteractive) {
+  auto screen = ScreenInteractive::FixedSize(10, 2);
+  EXPECT_EQ(screen.Profiler(), nullptr);
+  screen.EnableProfiler(8);
+  ASSERT_NE(screen.Profiler(), nullptr);
+
+  // 5 elements: vbox, text, hbox, text, and the one wrapping the element of
+  // every component.
+  auto component = Renderer([] {
+    return vbox({text("frame"), hbox({text("profile")})});
+  });
+
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  screen.PostEvent(Event::Custom);
+  screen.PostEvent(Event::Custom);
+  screen.PostEvent(Event::Custom);
+  loop.RunOnce();
+
+  FrameProfiler& profiler = *screen.Profiler();
+  ASSERT_EQ(profiler.size(), 2u);
+  EXPECT_EQ(profiler[0].frame, 1u);
+  EXPECT_EQ(profiler[1].frame, 2u);
+  EXPECT_EQ(profiler[1].tasks_handled, 3);
+  for (size_t i = 0; i < profiler.size(); ++i) {
+    EXPECT_EQ(profiler[i].render.layout_iterations, 1);
+    EXPECT_EQ(profiler[i].render.nodes, 5);
+    EXPECT_EQ(profiler[i].render.nodes_laid_out, 5);
+    EXPECT_GT(profiler[i].bytes, 0u);
+    EXPECT_GE(profiler[i].total, profiler[i].component + profiler[i].output);
+  }
+
+  screen.DisableProfiler();
+  EXPECT_EQ(screen.Profiler(), nullptr);
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -0,0 +1,199 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/component/hit_map.hpp"
+
+#include <algorithm>         // for fill_n, max, reverse, sort, swap
+#include <atomic>            // for atomic, memory_order_relaxed
+#include <initializer_list>  // for initializer_list
+#include <utility>           // for move
+#include <vector>            // for vector
+
+namespace ftxui {
+
+namespace {
+
+thread_local HitMap* g_current = nullptr;        // NOLINT
+thread_local const HitMap* g_routing = nullptr;  // NOLINT
+
+// Elements are drawn concurrently only when they don't overlap: the order of
+// those overlapping is kept.
+std::atomic<uint64_t> g_draw_order{0};  // NOLINT
+
+}  // namespace
+
+void HitMap::Drawn::Draw(Box visible) {
+  box = visible;
+  order = g_draw_order.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+HitMap::Scope::Scope(HitMap* map) : previous_(g_current) {
+  g_current = map;
+}
+
+HitMap::Scope::~Scope() {
+  g_current = previous_;
+}
+
+HitMap* HitMap::Current() {
+  return g_current;
+}
+
+HitMap::RouteScope::RouteScope(const HitMap* map) : previous_(g_routing) {
+  g_routing = map;
+}
+
+HitMap::RouteScope::~RouteScope() {
+  g_routing = previous_;
+}
+
+const HitMap* HitMap::Routing() {
+  return g_routing;
+}
+
+void HitMap::Clear() {
+  records_.clear();
+  open_.clear();
+}
+
+int HitMap::Open(const ComponentBase* component,
+                 const ComponentBase* parent,
+                 const Components* siblings) {
+  // The parent is usually the component rendered last, and renders its
+  // children in order: look for the child after the previous one.
+  int parent_record = -1;
+  size_t index = 0;
+  if (parent && siblings && !siblings->empty()) {
+    for (auto it = open_.rbegin(); it != open_.rend(); ++it) {
+      if (records_[*it].component == parent) {
+        parent_record = *it;
+        break;
+      }
+    }
+  }
+  if (parent_record != -1) {
+    Record& record = records_[parent_record];
+    const size_t size = siblings->size();
+    bool found = false;
+    for (size_t i = 0; i < size && !found; ++i) {
+      index = (record.next_child + i) % size;
+      found = (*siblings)[index].get() == component;
+    }
+    if (found) {
+      record.next_child = index + 1;
+    } else {
+      parent_record = -1;
+    }
+  }
+
+  const int id = static_cast<int>(records_.size());
+  Record record;
+  record.component = component;
+  record.parent = parent_record;
+  record.index = index;
+  records_.push_back(std::move(record));
+  open_.push_back(id);
+  return id;
+}
+
+void HitMap::Close(int record, Element node, const Drawn* drawn) {
+  records_[record].node = std::move(node);
+  records_[record].drawn = drawn;
+  if (!open_.empty() && open_.back() == record) {
+    open_.pop_back();
+  }
+}
+
+void HitMap::Paint(int dimx, int dimy) {
+  order_.clear();
+  for (size_t i = 0; i < records_.size(); ++i) {
+    const Drawn* drawn = records_[i].drawn;
+    if (drawn && drawn->order != 0) {
+      order_.push_back(static_cast<int>(i));
+    }
+  }
+  std::sort(order_.begin(), order_.end(), [&](int a, int b) {
+    return records_[a].drawn->order < records_[b].drawn->order;
+  });
+
+  dimx_ = dimx;
+  dimy_ = dimy;
+  cells_.assign(size_t(dimx) * size_t(dimy), -1);
+  const Box screen = {0, dimx - 1, 0, dimy - 1};
+  for (const int i : order_) {
+    const Box box = Box::Intersection(records_[i].drawn->box, screen);
+    for (int y = box.y_min; y <= box.y_max; ++y) {
+      std::fill_n(cells_.begin() + y * dimx + box.x_min,
+                  box.x_max - box.x_min + 1, i);
+    }
+  }
+
+  // The elements of the frame are no longer needed.
+  for (Record& record : records_) {
+    record.node = nullptr;
+    record.drawn = nullptr;
+  }
+  open_.clear();
+}
+
+void HitMap::Route(int x, int y) {
+  std::swap(path_, previous_path_);
+  path_.clear();
+  x_ = x;
+  y_ = y;
+  if (records_.empty()) {
+    return;
+  }
+
+  // Outside of any component, only the root is on the path.
+  int record = 0;
+  if (x >= 0 && y >= 0 && x < dimx_ && y < dimy_) {
+    record = std::max(0, cells_[x + y * dimx_]);
+  }
+  while (record != -1 && record < static_cast<int>(records_.size())) {
+    path_.push_back({records_[record].component, records_[record].index});
+    record = records_[record].parent;
+  }
+  std::reverse(path_.begin(), path_.end());
+}
+
+int HitMap::Children(const ComponentBase* component,
+                     const Components& children,
+                     int x,
+                     int y,
+                     Step* out) const {
+  if (x != x_ || y != y_) {
+    return -1;
+  }
+  bool found = false;
+  int count = 0;
+  for (const std::vector<Step>* path : {&path_, &previous_path_}) {
+    for (size_t i = 0; i < path->size(); ++i) {
+      if ((*path)[i].component != component) {
+        continue;
+      }
+      found = true;
+      if (i + 1 == path->size()) {
+        break;
+      }
+      const Step& next = (*path)[i + 1];
+      if (next.index >= children.size() ||
+          children[next.index].get() != next.component) {
+        return -1;
+      }
+      if (count == 0 || out[0].index != next.index) {
+        out[count++] = next;
+      }
+      break;
+    }
+  }
+  if (!found) {
+    return -1;
+  }
+  if (count == 2 && out[1].index < out[0].index) {
+    std::swap(out[0], out[1]);
+  }
+  return count;
+}
+
+}  // namespace ftxui
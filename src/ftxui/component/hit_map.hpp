@@ -0,0 +1,136 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_COMPONENT_HIT_MAP_HPP
+#define FTXUI_COMPONENT_HIT_MAP_HPP
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t
+#include <vector>   // for vector
+
+#include "ftxui/component/component_base.hpp"  // for ComponentBase, Components
+#include "ftxui/dom/elements.hpp"              // for Element
+#include "ftxui/screen/box.hpp"                // for Box
+
+namespace ftxui {
+
+// The components drawn on every cell of a frame, used to route the mouse
+// events.
+//
+// While a HitMap::Scope is alive, ComponentBase::Render() records the rendered
+// components. Once the frame is drawn, Paint() writes every component drawn
+// over the cells of its visible box, in the order they were drawn: each cell
+// then holds the topmost component drawn there.
+//
+// While a HitMap::RouteScope is alive, ComponentBase::OnEvent() delivers a
+// mouse event only to the children on the path from the root to the topmost
+// component under the mouse, and to the ones on the path of the previous mouse
+// event, so that they can notice the mouse has left. Components are only
+// compared to the pointers recorded, never dereferenced: those destroyed since
+// the frame was drawn are ignored.
+class HitMap {
+ public:
+  // A component, and its index in the children of its parent.
+  struct Step {
+    const ComponentBase* component = nullptr;
+    size_t index = 0;
+  };
+
+  // Where and when the element of a component was drawn.
+  struct Drawn {
+    Box box = {0, -1, 0, -1};
+    uint64_t order = 0;  // 0 when not drawn.
+
+    // Called when drawing the element, with the part of its box visible.
+    // Thread safe.
+    void Draw(Box visible);
+  };
+
+  // Record the components rendered into |map| while alive.
+  class Scope {
+   public:
+    explicit Scope(HitMap* map);
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+    ~Scope();
+
+   private:
+    HitMap* previous_;
+  };
+
+  // The map of the current thread recording the components rendered, or
+  // nullptr.
+  static HitMap* Current();
+
+  // Route the mouse events through |map| while alive. nullptr delivers them to
+  // every child.
+  class RouteScope {
+   public:
+    explicit RouteScope(const HitMap* map);
+    RouteScope(const RouteScope&) = delete;
+    RouteScope& operator=(const RouteScope&) = delete;
+    ~RouteScope();
+
+   private:
+    const HitMap* previous_;
+  };
+
+  // The map routing the mouse events on the current thread, or nullptr.
+  static const HitMap* Routing();
+
+  // Forget the components of the previous frame.
+  void Clear();
+
+  // Record |component| before rendering it. |parent| and |siblings| are its
+  // parent, and the children of its parent, if any.
+  int Open(const ComponentBase* component,
+           const ComponentBase* parent,
+           const Components* siblings);
+
+  // Record the element |node| rendered by Open()'s component, and where it
+  // will be |drawn|.
+  void Close(int record, Element node, const Drawn* drawn);
+
+  // Draw the components recorded over a |dimx| x |dimy| frame.
+  void Paint(int dimx, int dimy);
+
+  // Find the path to the topmost component at (x, y). The path found becomes
+  // the previous one on the next call.
+  void Route(int x, int y);
+
+  // The children of |component| a mouse event at (x, y) is routed to, in
+  // order: at most two. Returns -1 when the event must be delivered to every
+  // child: |component| isn't on the paths, (x, y) isn't where Route() was last
+  // called, or the children have changed since the frame was drawn.
+  int Children(const ComponentBase* component,
+               const Components& children,
+               int x,
+               int y,
+               Step* out) const;
+
+ private:
+  struct Record {
+    const ComponentBase* component = nullptr;
+    int parent = -1;
+    size_t index = 0;
+    size_t next_child = 0;  // Where to look for the next child rendered.
+    Element node;           // Kept alive until painted.
+    const Drawn* drawn = nullptr;
+  };
+
+  std::vector<Record> records_;
+  std::vector<int> open_;  // The records being rendered.
+  std::vector<int> order_;
+  std::vector<int> cells_;
+  int dimx_ = 0;
+  int dimy_ = 0;
+
+  std::vector<Step> path_;
+  std::vector<Step> previous_path_;
+  int x_ = -1;
+  int y_ = -1;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_COMPONENT_HIT_MAP_HPP
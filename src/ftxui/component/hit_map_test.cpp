@@ -0,0 +1,203 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/component/hit_map.hpp"
+
+#include <memory>   // for make_shared, shared_ptr
+#include <utility>  // for move
+
+#include "ftxui/component/component.hpp"  // for Hoverable, Horizontal, Vertical, Make, Renderer
+#include "ftxui/component/component_base.hpp"  // for ComponentBase, Component
+#include "ftxui/component/event.hpp"           // for Event
+#include "ftxui/component/mouse.hpp"           // for Mouse
+#include "ftxui/dom/elements.hpp"              // for text, dbox, Element
+#include "ftxui/dom/node.hpp"                  // for Render
+#include "ftxui/screen/screen.hpp"             // for Screen
+#include "gtest/gtest.h"  // for Test, EXPECT_EQ, TEST, EXPECT_TRUE, EXPECT_FALSE
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+Event MoveEvent(int x, int y) {
+  Mouse mouse;
+  mouse.button = Mouse::None;
+  mouse.motion = Mouse::Moved;
+  mouse.x = x;
+  mouse.y = y;
+  return Event::Mouse("", mouse);
+}
+
+class Counter : public ComponentBase {
+ public:
+  int events = 0;
+
+ private:
+  Element OnRender() override { return text("x"); }
+  bool Focusable() const override { return true; }
+  bool OnEvent(Event) override {
+    events++;
+    return false;
+  }
+};
+
+// Draw |component|, recording it into |map|, like ScreenInteractive does.
+void Draw(HitMap& map, const Component& component, Screen& screen) {
+  map.Clear();
+  Element element;
+  {
+    const HitMap::Scope scope(&map);
+    element = component->Render();
+  }
+  Render(screen, element);
+  map.Paint(screen.width(), screen.height());
+}
+
+// Deliver |event| to |component|, like ScreenInteractive does.
+bool Dispatch(HitMap& map, const Component& component, Event event) {
+  map.Route(event.mouse().x, event.mouse().y);
+  const HitMap::RouteScope route(&map);
+  return component->OnEvent(event);
+}
+
+}  // namespace
+
+TEST(HitMapTest, RouteToTheComponentUnderTheMouse) {
+  auto a = std::make_shared<Counter>();
+  auto b = std::make_shared<Counter>();
+  auto c = std::make_shared<Counter>();
+  auto layout = Container::Vertical({a, b, c});
+  Screen screen(3, 3);
+  HitMap map;
+  Draw(map, layout, screen);
+
+  Dispatch(map, layout, MoveEvent(0, 1));
+  EXPECT_EQ(a->events, 0);
+  EXPECT_EQ(b->events, 1);
+  EXPECT_EQ(c->events, 0);
+
+  // |b| is notified the mouse has left.
+  Dispatch(map, layout, MoveEvent(0, 2));
+  EXPECT_EQ(a->events, 0);
+  EXPECT_EQ(b->events, 2);
+  EXPECT_EQ(c->events, 1);
+
+  Dispatch(map, layout, MoveEvent(0, 2));
+  EXPECT_EQ(b->events, 2);
+  EXPECT_EQ(c->events, 2);
+
+  // Outside of every component.
+  Dispatch(map, layout, MoveEvent(5, 5));
+  EXPECT_EQ(c->events, 3);
+  Dispatch(map, layout, MoveEvent(5, 5));
+  EXPECT_EQ(a->events, 0);
+  EXPECT_EQ(b->events, 2);
+  EXPECT_EQ(c->events, 3);
+}
+
+TEST(HitMapTest, Hoverable) {
+  bool hover_1 = false;
+  bool hover_2 = false;
+  auto c1 = Hoverable(Renderer([] { return text("[ ]"); }), &hover_1);
+  auto c2 = Hoverable(Renderer([] { return text("[ ]"); }), &hover_2);
+  auto layout = Container::Horizontal({c1, c2});
+  Screen screen(8, 2);
+  HitMap map;
+  Draw(map, layout, screen);
+
+  Dispatch(map, layout, MoveEvent(1, 0));
+  EXPECT_TRUE(hover_1);
+  EXPECT_FALSE(hover_2);
+
+  Dispatch(map, layout, MoveEvent(4, 0));
+  EXPECT_FALSE(hover_1);
+  EXPECT_TRUE(hover_2);
+
+  Dispatch(map, layout, MoveEvent(7, 1));
+  EXPECT_FALSE(hover_1);
+  EXPECT_FALSE(hover_2);
+}
+
+TEST(HitMapTest, Topmost) {
+  // Draw the first child on top of the second, rendered after.
+  class Stack : public ComponentBase {
+   public:
+    Stack(Component a, Component b) {
+      Add(std::move(a));
+      Add(std::move(b));
+    }
+
+   private:
+    Element OnRender() override {
+      Element top = children_[0]->Render();
+      Element bottom = children_[1]->Render();
+      return dbox({std::move(bottom), std::move(top)});
+    }
+  };
+  auto a = std::make_shared<Counter>();
+  auto b = std::make_shared<Counter>();
+  auto stack = Make<Stack>(a, b);
+  Screen screen(3, 3);
+  HitMap map;
+  Draw(map, stack, screen);
+
+  Dispatch(map, stack, MoveEvent(0, 0));
+  EXPECT_EQ(a->events, 1);
+  EXPECT_EQ(b->events, 0);
+}
+
+TEST(HitMapTest, ChildrenModifiedSinceDrawn) {
+  auto a = std::make_shared<Counter>();
+  auto b = std::make_shared<Counter>();
+  auto layout = Container::Vertical({a, b});
+  Screen screen(3, 3);
+  HitMap map;
+  Draw(map, layout, screen);
+
+  // |b| is no longer where it was drawn: every child gets the event.
+  auto c = std::make_shared<Counter>();
+  layout->DetachAllChildren();
+  layout->Add(c);
+  layout->Add(a);
+  layout->Add(b);
+  Dispatch(map, layout, MoveEvent(0, 1));
+  EXPECT_EQ(a->events, 1);
+  EXPECT_EQ(b->events, 1);
+  EXPECT_EQ(c->events, 1);
+}
+
+TEST(HitMapTest, NotRouted) {
+  auto a = std::make_shared<Counter>();
+  auto b = std::make_shared<Counter>();
+  auto layout = Container::Vertical({a, b});
+  Screen screen(3, 3);
+  HitMap map;
+  Draw(map, layout, screen);
+
+  // An event elsewhere than the one routed.
+  map.Route(0, 0);
+  {
+    const HitMap::RouteScope route(&map);
+    layout->OnEvent(MoveEvent(0, 1));
+  }
+  EXPECT_EQ(a->events, 1);
+  EXPECT_EQ(b->events, 1);
+
+  // Without a route.
+  layout->OnEvent(MoveEvent(0, 1));
+  EXPECT_EQ(a->events, 2);
+  EXPECT_EQ(b->events, 2);
+
+  // Not a mouse event.
+  map.Route(0, 0);
+  {
+    const HitMap::RouteScope route(&map);
+    layout->OnEvent(Event::Character('a'));
+  }
+  EXPECT_EQ(a->events, 3);
+  EXPECT_EQ(b->events, 2);
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -1,24 +1,25 @@
 // Copyright 2022 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <algorithm>   // for max, min
-#include <cstddef>     // for size_t
-#include <cstdint>     // for uint32_t
-#include <functional>  // for function
-#include <sstream>     // for basic_istream, stringstream
-#include <string>      // for string, basic_string, operator==, getline
-#include <utility>     // for move
-#include <vector>      // for vector
+#include <algorithm>    // for max, min
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint32_t
+#include <functional>   // for function
+#include <string>       // for string, basic_string, operator==
+#include <string_view>  // for string_view
+#include <utility>      // for move
 
 #include "ftxui/component/component.hpp"          // for Make, Input
 #include "ftxui/component/component_base.hpp"     // for ComponentBase
 #include "ftxui/component/component_options.hpp"  // for InputOption
 #include "ftxui/component/event.hpp"  // for Event, Event::ArrowDown, Event::ArrowLeft, Event::ArrowLeftCtrl, Event::ArrowRight, Event::ArrowRightCtrl, Event::ArrowUp, Event::Backspace, Event::Delete, Event::End, Event::Home, Event::Return
+#include "ftxui/component/line_index.hpp"  // for LineIndex
 #include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::Left, Mouse::Pressed
 #include "ftxui/component/screen_interactive.hpp"  // for Component
 #include "ftxui/dom/elements.hpp"  // for operator|, reflect, text, Element, xflex, hbox, Elements, frame, operator|=, vbox, focus, focusCursorBarBlinking, select
 #include "ftxui/screen/box.hpp"    // for Box
 #include "ftxui/screen/string.hpp"           // for string_width
+#include "ftxui/screen/terminal.hpp"         // for Size
 //#include "ftxui/screen/string_internal.hpp"  // for GlyphNext, GlyphPrevious, WordBreakProperty, EatCodePoint, CodepointToWordBreakProperty, IsFullWidth, WordBreakProperty::ALetter, WordBreakProperty::CR, WordBreakProperty::Double_Quote, WordBreakProperty::Extend, WordBreakProperty::ExtendNumLet, WordBreakProperty::Format, WordBreakProperty::Hebrew_Letter, WordBreakProperty::Katakana, WordBreakProperty::LF, WordBreakProperty::MidLetter, WordBreakProperty::MidNum, WordBreakProperty::MidNumLet, WordBreakProperty::Newline, WordBreakProperty::Numeric, WordBreakProperty::Regional_Indicator, WordBreakProperty::Single_Quote, WordBreakProperty::WSegSpace, WordBreakProperty::ZWJ
 #include "ftxui/screen/util.hpp"             // for clamp
 #include "ftxui/util/ref.hpp"                // for StringRef, Ref
@@ -27,19 +28,6 @@ namespace ftxui {
 
 namespace {
 
-std::vector<std::string> Split(const std::string& input) {
-  std::vector<std::string> output;
-  std::stringstream ss(input);
-  std::string line;
-  while (std::getline(ss, line)) {
-    output.push_back(line);
-  }
-  if (input.back() == '\n') {
-    output.emplace_back("");
-  }
-  return output;
-}
-
 size_t GlyphWidth(const std::string& input, size_t iter) {
   uint32_t ucs = 0;
   if (!EatCodePoint(input, iter, &iter, &ucs)) {
@@ -116,33 +104,30 @@ class InputBase : public ComponentBase, public InputOption {
              focus | reflect(box_);
     }
 
-    Elements elements;
-    const std::vector<std::string> lines = Split(*content);
-
     cursor_position() = util::clamp(cursor_position(), 0, (int)content->size());
+    SyncLines();
 
-    // Find the line and index of the cursor.
+    // Find the line of the cursor, and the lines to build.
     int cursor_line = 0;
-    int cursor_char_index = cursor_position();
-    for (const auto& line : lines) {
-      if (cursor_char_index <= (int)line.size()) {
-        break;
-      }
-
-      cursor_char_index -= static_cast<int>(line.size() + 1);
-      cursor_line++;
-    }
+    int first_line = 0;
+    int last_line = 0;
+    LocateLines(&cursor_line, &first_line, &last_line);
 
-    if (lines.empty()) {
-      elements.push_back(text("") | focused);
+    // The lines scrolled into view may have been modified elsewhere.
+    if (virtualized() && !lines_.Check(content(), first_line, last_line)) {
+      lines_.Rebuild(content());
+      LocateLines(&cursor_line, &first_line, &last_line);
     }
+    const int cursor_char_index =
+        cursor_position() - static_cast<int>(lines_.LineStart(cursor_line));
 
-    elements.reserve(lines.size());
-    for (size_t i = 0; i < lines.size(); ++i) {
-      const std::string& line = lines[i];
+    Elements elements;
+    elements.reserve(last_line - first_line);
+    for (int i = first_line; i < last_line; ++i) {
+      const std::string line = Line(i);
 
       // This is not the cursor line.
-      if (int(i) != cursor_line) {
+      if (i != cursor_line) {
         elements.push_back(Text(line));
         continue;
       }
@@ -173,7 +158,8 @@ class InputBase : public ComponentBase, public InputOption {
       elements.push_back(element);
     }
 
-    auto element = vbox(std::move(elements), cursor_line) | frame;
+    auto element = vbox(std::move(elements), cursor_line - first_line) |
+                   frame | reflect(frame_box_);
     return transform_func({
                std::move(element), hovered_, is_focused,
                false  // placeholder
@@ -181,6 +167,66 @@ class InputBase : public ComponentBase, public InputOption {
            xflex | reflect(box_);
   }
 
+  // The number of lines displayed on the previous frame. Before the first
+  // frame, the height of the terminal.
+  int DisplayedHeight() const {
+    const int height = frame_box_.y_max - frame_box_.y_min + 1;
+    return height > 1 ? height : Terminal::Size().dimy;
+  }
+
+  // Find the line of the cursor, and the lines [first, last) to build.
+  void LocateLines(int* cursor_line, int* first_line, int* last_line) {
+    *cursor_line = static_cast<int>(lines_.LineOf(cursor_position()));
+    *first_line = 0;
+    *last_line = static_cast<int>(lines_.LineCount());
+    if (!virtualized()) {
+      return;
+    }
+
+    // Build as many lines as displayed on the previous frame.
+    const int height = DisplayedHeight();
+    scroll_line_ =
+        util::clamp(scroll_line_, *cursor_line - height + 1, *cursor_line);
+    scroll_line_ =
+        util::clamp(scroll_line_, 0, std::max(0, *last_line - height));
+    *first_line = scroll_line_;
+    *last_line = std::min(*last_line, *first_line + height);
+  }
+
+  // Update the line index, unless it is known to be up to date. When
+  // virtualized, the index is updated by the edits. It is rebuilt if the
+  // content was modified elsewhere: resized, moved, or with the lines
+  // displayed or around the cursor no longer where they are indexed.
+  void SyncLines() {
+    if (!virtualized() || !lines_.Matches(content())) {
+      lines_.Rebuild(content());
+      return;
+    }
+    const size_t cursor_line = lines_.LineOf(cursor_position());
+    const size_t first = static_cast<size_t>(scroll_line_);
+    if (!lines_.Check(content(), first, first + DisplayedHeight()) ||
+        !lines_.Check(content(), cursor_line == 0 ? 0 : cursor_line - 1,
+                      cursor_line + 2)) {
+      lines_.Rebuild(content());
+    }
+  }
+
+  std::string Line(int line) {
+    return content->substr(lines_.LineStart(line), lines_.LineSize(line));
+  }
+
+  // Edit the content, keeping the line index up to date.
+  void Insert(size_t position, const std::string& text) {
+    content->insert(position, text);
+    lines_.OnInsert(content(), position, text);
+  }
+
+  void Erase(size_t start, size_t end) {
+    const std::string erased = content->substr(start, end - start);
+    content->erase(start, end - start);
+    lines_.OnErase(content(), start, erased);
+  }
+
   Element Text(const std::string& input) {
     if (!password()) {
       return text(input);
@@ -200,7 +246,7 @@ class InputBase : public ComponentBase, public InputOption {
     }
     const size_t start = GlyphPrevious(content(), cursor_position());
     const size_t end = cursor_position();
-    content->erase(start, end - start);
+    Erase(start, end);
     cursor_position() = static_cast<int>(start);
     on_change();
     return true;
@@ -212,7 +258,7 @@ class InputBase : public ComponentBase, public InputOption {
     }
     const size_t start = cursor_position();
     const size_t end = GlyphNext(content(), cursor_position());
-    content->erase(start, end - start);
+    Erase(start, end);
     return true;
   }
 
@@ -357,14 +403,57 @@ class InputBase : public ComponentBase, public InputOption {
         content()[cursor_position()] != '\n') {
       DeleteImpl();
     }
-    content->insert(cursor_position(), character);
+    Insert(cursor_position(), character);
     cursor_position() += static_cast<int>(character.size());
     on_change();
     return true;
   }
 
+  // Insert a pasted text with a single edit. Like when it is typed, newlines
+  // are only kept by multiline inputs, and the other control characters are
+  // dropped.
+  bool HandlePaste(std::string_view pasted) {
+    std::string text;
+    text.reserve(pasted.size());
+    for (size_t i = 0; i < pasted.size(); ++i) {
+      const char c = pasted[i];
+      if (c == '\r' || c == '\n') {
+        const bool crlf =
+            c == '\r' && i + 1 < pasted.size() && pasted[i + 1] == '\n';
+        if (multiline() && !crlf) {
+          text += '\n';
+        }
+        continue;
+      }
+      if (static_cast<unsigned char>(c) < ' ' || c == 127) {  // NOLINT
+        continue;
+      }
+      text += c;
+    }
+    if (text.empty()) {
+      return true;
+    }
+
+    // Overwrite as many glyphs as inserted, up to the end of the line.
+    if (!insert()) {
+      size_t end = cursor_position();
+      for (size_t i = 0; i < text.size() && end < content->size() &&
+                         content()[end] != '\n';
+           i = GlyphNext(text, i)) {
+        end = GlyphNext(content(), end);
+      }
+      Erase(cursor_position(), end);
+    }
+
+    Insert(cursor_position(), text);
+    cursor_position() += static_cast<int>(text.size());
+    on_change();
+    return true;
+  }
+
   bool OnEvent(Event event) override {
     cursor_position() = util::clamp(cursor_position(), 0, (int)content->size());
+    SyncLines();
 
     if (event == Event::Return) {
       return HandleReturn();
@@ -372,6 +461,9 @@ class InputBase : public ComponentBase, public InputOption {
     if (event.is_character()) {
       return HandleCharacter(event.character());
     }
+    if (event.is_paste()) {
+      return HandlePaste(event.paste());
+    }
     if (event.is_mouse()) {
       return HandleMouse(event);
     }
@@ -483,30 +575,21 @@ class InputBase : public ComponentBase, public InputOption {
     }
 
     // Find the line and index of the cursor.
-    std::vector<std::string> lines = Split(*content);
-    int cursor_line = 0;
-    int cursor_char_index = cursor_position();
-    for (const auto& line : lines) {
-      if (cursor_char_index <= (int)line.size()) {
-        break;
-      }
-
-      cursor_char_index -= static_cast<int>(line.size() + 1);
-      cursor_line++;
-    }
+    const int line_count = static_cast<int>(lines_.LineCount());
+    const int cursor_line = static_cast<int>(lines_.LineOf(cursor_position()));
+    const int cursor_char_index =
+        cursor_position() - static_cast<int>(lines_.LineStart(cursor_line));
     const int cursor_column =
-        string_width(lines[cursor_line].substr(0, cursor_char_index));
+        string_width(Line(cursor_line).substr(0, cursor_char_index));
 
     int new_cursor_column = cursor_column + event.mouse().x - cursor_box_.x_min;
     int new_cursor_line = cursor_line + event.mouse().y - cursor_box_.y_min;
 
     // Fix the new cursor position:
-    new_cursor_line = std::max(std::min(new_cursor_line, (int)lines.size()), 0);
+    new_cursor_line = std::max(std::min(new_cursor_line, line_count), 0);
 
-    const std::string empty_string;
-    const std::string& line = new_cursor_line < (int)lines.size()
-                                  ? lines[new_cursor_line]
-                                  : empty_string;
+    const std::string line =
+        new_cursor_line < line_count ? Line(new_cursor_line) : std::string();
     new_cursor_column = util::clamp(new_cursor_column, 0, string_width(line));
 
     if (new_cursor_column == cursor_column &&  //
@@ -515,10 +598,12 @@ class InputBase : public ComponentBase, public InputOption {
     }
 
     // Convert back the new_cursor_{line,column} toward cursor_position:
-    cursor_position() = 0;
-    for (int i = 0; i < new_cursor_line; ++i) {
-      cursor_position() += static_cast<int>(lines[i].size() + 1);
+    if (new_cursor_line == line_count) {
+      cursor_position() = static_cast<int>(content->size());
+      on_change();
+      return true;
     }
+    cursor_position() = static_cast<int>(lines_.LineStart(new_cursor_line));
     while (new_cursor_column > 0) {
       new_cursor_column -=
           static_cast<int>(GlyphWidth(content(), cursor_position()));
@@ -541,6 +626,10 @@ class InputBase : public ComponentBase, public InputOption {
 
   Box box_;
   Box cursor_box_;
+  Box frame_box_;
+
+  LineIndex lines_;
+  int scroll_line_ = 0;  // The first line built, when virtualized.
 };
 
 }  // namespace
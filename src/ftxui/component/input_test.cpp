@@ -781,4 +781,111 @@ TEST(InputTest, InsertMode) {
   EXPECT_EQ(content, "axyz\nefgX");
 }
 
+TEST(InputTest, Virtualized) {
+  std::string content;
+  for (int i = 0; i < 100; ++i) {
+    content += std::to_string(i % 10) + "\n";
+  }
+  int cursor_position = 100;  // Beginning of the line 50.
+  Component input = Input({
+      .content = &content,
+      .virtualized = true,
+      .cursor_position = &cursor_position,
+  });
+
+  auto screen = Screen::Create(Dimension::Fixed(10), Dimension::Fixed(1));
+  Render(screen, input->Render());
+  EXPECT_EQ(screen.PixelAt(0, 0).character, "0");
+
+  EXPECT_TRUE(input->OnEvent(Event::Character('a')));
+  EXPECT_EQ(content.substr(98, 6), "9\na0\n1");
+  EXPECT_TRUE(input->OnEvent(Event::Return));
+  EXPECT_EQ(content.substr(98, 7), "9\na\n0\n1");
+  EXPECT_EQ(cursor_position, 102);
+
+  EXPECT_TRUE(input->OnEvent(Event::ArrowDown));
+  EXPECT_EQ(cursor_position, 104);
+  EXPECT_TRUE(input->OnEvent(Event::ArrowUp));
+  EXPECT_TRUE(input->OnEvent(Event::ArrowUp));
+  EXPECT_EQ(cursor_position, 100);
+
+  screen.Clear();
+  Render(screen, input->Render());
+  EXPECT_EQ(screen.PixelAt(0, 0).character, "a");
+
+  // Joining two lines.
+  EXPECT_TRUE(input->OnEvent(Event::Backspace));
+  EXPECT_EQ(content.substr(96, 6), "8\n9a\n0");
+  EXPECT_EQ(cursor_position, 99);
+
+  screen.Clear();
+  Render(screen, input->Render());
+  EXPECT_EQ(screen.PixelAt(0, 0).character, "9");
+  EXPECT_EQ(screen.PixelAt(1, 0).character, "a");
+
+  // Replacing the content.
+  content = "x\ny";
+  cursor_position = 3;
+  screen.Clear();
+  Render(screen, input->Render());
+  EXPECT_EQ(screen.PixelAt(0, 0).character, "y");
+
+  // Replacing the content, keeping its buffer and its size.
+  const std::string other = "xy\n";
+  content = other;
+  cursor_position = 0;
+  screen.Clear();
+  Render(screen, input->Render());
+  EXPECT_EQ(screen.PixelAt(0, 0).character, "x");
+  EXPECT_EQ(screen.PixelAt(1, 0).character, "y");
+}
+
+TEST(InputTest, Paste) {
+  std::string content = "ab";
+  int cursor_position = 1;
+  int on_change = 0;
+  bool on_enter = false;
+  Component input = Input({
+      .content = &content,
+      .on_change = [&] { ++on_change; },
+      .on_enter = [&] { on_enter = true; },
+      .cursor_position = &cursor_position,
+  });
+
+  // One edit, keeping the newlines.
+  EXPECT_TRUE(input->OnEvent(Event::Paste("x\r\ny\rz\t")));
+  EXPECT_EQ(content, "ax\ny\nzb");
+  EXPECT_EQ(cursor_position, 6);
+  EXPECT_EQ(on_change, 1);
+  EXPECT_FALSE(on_enter);
+
+  // Without the newlines, for a single line input.
+  content = "ab";
+  cursor_position = 2;
+  Component line = Input({
+      .content = &content,
+      .multiline = false,
+      .cursor_position = &cursor_position,
+  });
+  EXPECT_TRUE(line->OnEvent(Event::Paste("c\rd\n")));
+  EXPECT_EQ(content, "abcd");
+  EXPECT_EQ(cursor_position, 4);
+}
+
+TEST(InputTest, PasteInsertMode) {
+  std::string content = "abc\nefg";
+  bool insert = false;
+  int cursor_position = 1;
+  Component input = Input({
+      .content = &content,
+      .insert = &insert,
+      .cursor_position = &cursor_position,
+  });
+
+  EXPECT_TRUE(input->OnEvent(Event::Paste("x")));
+  EXPECT_EQ(content, "axc\nefg");
+  EXPECT_TRUE(input->OnEvent(Event::Paste("yzw")));
+  EXPECT_EQ(content, "axyzw\nefg");
+}
+
 }  // namespace ftxui
@@ -0,0 +1,133 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/component/line_index.hpp"
+
+#include <algorithm>    // for min
+#include <cstring>      // for memchr
+#include <string>       // for string
+#include <string_view>  // for string_view
+
+namespace ftxui {
+
+void LineIndex::Rebuild(const std::string& text) {
+  lengths_.clear();
+  const char* begin = text.data();
+  const char* end = begin + text.size();
+  const char* line = begin;
+  while (const void* found = std::memchr(line, '\n', end - line)) {
+    const char* next = static_cast<const char*>(found) + 1;
+    lengths_.push_back(next - line);
+    line = next;
+  }
+  lengths_.push_back(end - line);
+
+  // Build the Fenwick tree in O(n): every node adds itself to its parent.
+  tree_.assign(lengths_.size() + 1, 0);
+  for (size_t i = 1; i < tree_.size(); ++i) {
+    tree_[i] += lengths_[i - 1];
+    const size_t parent = i + (i & (~i + 1));
+    if (parent < tree_.size()) {
+      tree_[parent] += tree_[i];
+    }
+  }
+
+  Track(text);
+}
+
+bool LineIndex::Matches(const std::string& text) const {
+  return !lengths_.empty() && text.data() == data_ && text.size() == size_;
+}
+
+bool LineIndex::Check(const std::string& text,
+                      size_t first,
+                      size_t last) const {
+  last = std::min(last, lengths_.size());
+  if (first >= last) {
+    return true;
+  }
+  size_t start = LineStart(first);
+  if (first != 0 && (start > text.size() || text[start - 1] != '\n')) {
+    return false;
+  }
+  for (size_t line = first; line < last; ++line) {
+    const size_t size = LineSize(line);
+    const size_t end = start + size;
+    if (end > text.size() || std::memchr(text.data() + start, '\n', size)) {
+      return false;
+    }
+    const bool is_last = line + 1 == lengths_.size();
+    if (is_last ? end != text.size()
+                : end == text.size() || text[end] != '\n') {
+      return false;
+    }
+    start = end + 1;
+  }
+  return true;
+}
+
+void LineIndex::OnInsert(const std::string& text,
+                         size_t offset,
+                         std::string_view inserted) {
+  if (inserted.find('\n') != std::string_view::npos) {
+    Rebuild(text);
+    return;
+  }
+  Add(LineOf(offset), static_cast<std::ptrdiff_t>(inserted.size()));
+  Track(text);
+}
+
+void LineIndex::OnErase(const std::string& text,
+                        size_t offset,
+                        std::string_view erased) {
+  if (erased.find('\n') != std::string_view::npos) {
+    Rebuild(text);
+    return;
+  }
+  Add(LineOf(offset), -static_cast<std::ptrdiff_t>(erased.size()));
+  Track(text);
+}
+
+size_t LineIndex::LineOf(size_t offset) const {
+  // Find the number of lines ending at or before |offset|, by descending the
+  // tree.
+  size_t line = 0;
+  size_t step = 1;
+  while (step * 2 < tree_.size()) {
+    step *= 2;
+  }
+  for (; step != 0; step /= 2) {
+    if (line + step < tree_.size() && tree_[line + step] <= offset) {
+      line += step;
+      offset -= tree_[line];
+    }
+  }
+  return std::min(line, lengths_.size() - 1);
+}
+
+size_t LineIndex::LineStart(size_t line) const {
+  size_t start = 0;
+  for (size_t i = line; i != 0; i -= i & (~i + 1)) {
+    start += tree_[i];
+  }
+  return start;
+}
+
+size_t LineIndex::LineSize(size_t line) const {
+  const bool last = line + 1 == lengths_.size();
+  return lengths_[line] - (last ? 0 : 1);
+}
+
+void LineIndex::Add(size_t line, std::ptrdiff_t delta) {
+  lengths_[line] += delta;
+  for (size_t i = line + 1; i < tree_.size(); i += i & (~i + 1)) {
+    tree_[i] += delta;
+  }
+}
+
+void LineIndex::Track(const std::string& text) {
+  data_ = text.data();
+  size_ = text.size();
+}
+
+}  // namespace ftxui
@@ -0,0 +1,67 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_COMPONENT_LINE_INDEX_HPP
+#define FTXUI_COMPONENT_LINE_INDEX_HPP
+
+#include <cstddef>      // for size_t, ptrdiff_t
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+namespace ftxui {
+
+// The position of the lines of a text. The text is split on '\n'. Lines are
+// counted like the editors do: "" has one line, and "a\n" has two.
+//
+// The length of the lines are stored in a Fenwick tree, so that converting
+// between a byte offset and a line is O(log n). Edits not adding nor removing
+// a '\n' are applied in O(log n). The others rebuild the index.
+class LineIndex {
+ public:
+  void Rebuild(const std::string& text);
+
+  // Whether the index was built or updated for |text|. This only compares its
+  // buffer and its size: modifying |text| in place, without changing its size,
+  // isn't detected.
+  bool Matches(const std::string& text) const;
+
+  // Whether the lines [first, last) are still lines of |text|: each one starts
+  // after a '\n', unless it is the first, and ends with one, unless it is the
+  // last, without any '\n' in between. This detects |text| being modified
+  // without notifying the index where those lines are, in O(their size).
+  bool Check(const std::string& text, size_t first, size_t last) const;
+
+  // Notify |text| has been modified. Call them after the modification.
+  void OnInsert(const std::string& text,
+                size_t offset,
+                std::string_view inserted);
+  void OnErase(const std::string& text,
+               size_t offset,
+               std::string_view erased);
+
+  size_t LineCount() const { return lengths_.size(); }
+
+  // The line containing the byte at |offset|. A '\n' belongs to the line it
+  // ends.
+  size_t LineOf(size_t offset) const;
+
+  // The byte offset of the beginning of |line|.
+  size_t LineStart(size_t line) const;
+
+  // The number of bytes of |line|, excluding the '\n'.
+  size_t LineSize(size_t line) const;
+
+ private:
+  void Add(size_t line, std::ptrdiff_t delta);
+  void Track(const std::string& text);
+
+  std::vector<size_t> lengths_;  // Including the '\n'.
+  std::vector<size_t> tree_;     // Fenwick tree over |lengths_|, 1-indexed.
+  const char* data_ = nullptr;
+  size_t size_ = 0;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_COMPONENT_LINE_INDEX_HPP
@@ -0,0 +1,139 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <cstddef>  // for size_t
+#include <string>   // for string
+
+#include "ftxui/component/line_index.hpp"
+#include "gtest/gtest.h"  // for Test, EXPECT_EQ, EXPECT_TRUE, EXPECT_FALSE, TEST
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+// Check |index| against a line index built from scratch.
+void ExpectRebuilt(const LineIndex& index, const std::string& text) {
+  LineIndex expected;
+  expected.Rebuild(text);
+  ASSERT_EQ(index.LineCount(), expected.LineCount());
+  for (size_t line = 0; line < expected.LineCount(); ++line) {
+    EXPECT_EQ(index.LineStart(line), expected.LineStart(line));
+    EXPECT_EQ(index.LineSize(line), expected.LineSize(line));
+  }
+  for (size_t offset = 0; offset <= text.size(); ++offset) {
+    EXPECT_EQ(index.LineOf(offset), expected.LineOf(offset));
+  }
+}
+
+}  // namespace
+
+TEST(LineIndexTest, Empty) {
+  LineIndex index;
+  index.Rebuild("");
+  EXPECT_EQ(index.LineCount(), 1u);
+  EXPECT_EQ(index.LineStart(0), 0u);
+  EXPECT_EQ(index.LineSize(0), 0u);
+  EXPECT_EQ(index.LineOf(0), 0u);
+}
+
+TEST(LineIndexTest, Lines) {
+  LineIndex index;
+  index.Rebuild("ab\n\ncde\n");
+  EXPECT_EQ(index.LineCount(), 4u);
+
+  EXPECT_EQ(index.LineStart(0), 0u);
+  EXPECT_EQ(index.LineStart(1), 3u);
+  EXPECT_EQ(index.LineStart(2), 4u);
+  EXPECT_EQ(index.LineStart(3), 8u);
+
+  EXPECT_EQ(index.LineSize(0), 2u);
+  EXPECT_EQ(index.LineSize(1), 0u);
+  EXPECT_EQ(index.LineSize(2), 3u);
+  EXPECT_EQ(index.LineSize(3), 0u);
+
+  // A '\n' belongs to the line it ends.
+  EXPECT_EQ(index.LineOf(0), 0u);
+  EXPECT_EQ(index.LineOf(2), 0u);
+  EXPECT_EQ(index.LineOf(3), 1u);
+  EXPECT_EQ(index.LineOf(4), 2u);
+  EXPECT_EQ(index.LineOf(7), 2u);
+  EXPECT_EQ(index.LineOf(8), 3u);
+}
+
+TEST(LineIndexTest, Edit) {
+  std::string text = "first\nsecond\nthird";
+  LineIndex index;
+  index.Rebuild(text);
+
+  text.insert(8, "xyz");
+  index.OnInsert(text, 8, "xyz");
+  ExpectRebuilt(index, text);
+
+  text.insert(0, "a\nb");
+  index.OnInsert(text, 0, "a\nb");
+  ExpectRebuilt(index, text);
+
+  text.erase(3, 6);
+  index.OnErase(text, 3, "first\n");
+  ExpectRebuilt(index, text);
+
+  text.erase(text.size() - 2, 2);
+  index.OnErase(text, text.size(), "rd");
+  ExpectRebuilt(index, text);
+
+  text.insert(text.size(), "\n");
+  index.OnInsert(text, text.size() - 1, "\n");
+  ExpectRebuilt(index, text);
+}
+
+TEST(LineIndexTest, ManyLines) {
+  std::string text;
+  for (int i = 0; i < 1000; ++i) {
+    text += std::string(i % 7, 'a') + "\n";
+  }
+  LineIndex index;
+  index.Rebuild(text);
+  for (size_t offset = 0; offset < text.size(); offset += 97) {
+    text.insert(offset, "bc");
+    index.OnInsert(text, offset, "bc");
+  }
+  ExpectRebuilt(index, text);
+}
+
+TEST(LineIndexTest, Matches) {
+  std::string text = "a\nb";
+  LineIndex index;
+  EXPECT_FALSE(index.Matches(text));
+
+  index.Rebuild(text);
+  EXPECT_TRUE(index.Matches(text));
+
+  text += "c";
+  EXPECT_FALSE(index.Matches(text));
+
+  index.OnInsert(text, 2, "c");
+  EXPECT_TRUE(index.Matches(text));
+}
+
+TEST(LineIndexTest, Check) {
+  std::string text = "ab\ncd\nef";
+  LineIndex index;
+  index.Rebuild(text);
+  EXPECT_TRUE(index.Check(text, 0, 3));
+  EXPECT_TRUE(index.Check(text, 1, 100));
+
+  // Modified in place: only the lines involved notice it.
+  text[1] = '\n';
+  text[2] = 'b';
+  EXPECT_TRUE(index.Matches(text));
+  EXPECT_FALSE(index.Check(text, 0, 1));
+  EXPECT_FALSE(index.Check(text, 1, 2));
+  EXPECT_TRUE(index.Check(text, 2, 3));
+
+  text = "ab\ncd\ne\n";
+  EXPECT_FALSE(index.Check(text, 2, 3));
+}
+
+}  // namespace ftxui
+// NOLINTEND
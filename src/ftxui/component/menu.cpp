@@ -5,6 +5,7 @@
 #include <chrono>                   // for milliseconds
 #include <ftxui/dom/direction.hpp>  // for Direction, Direction::Down, Direction::Left, Direction::Right, Direction::Up
 #include <functional>               // for function
+#include <map>                      // for map
 #include <string>                   // for operator+, string
 #include <utility>                  // for move
 #include <vector>                   // for vector, __alloc_traits<>::value_type
@@ -16,7 +17,7 @@
 #include "ftxui/component/event.hpp"  // for Event, Event::ArrowDown, Event::ArrowLeft, Event::ArrowRight, Event::ArrowUp, Event::End, Event::Home, Event::PageDown, Event::PageUp, Event::Return, Event::Tab, Event::TabReverse
 #include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::Left, Mouse::Released, Mouse::WheelDown, Mouse::WheelUp, Mouse::None
 #include "ftxui/component/screen_interactive.hpp"  // for Component
-#include "ftxui/dom/elements.hpp"  // for operator|, Element, reflect, Decorator, nothing, Elements, bgcolor, color, hbox, separatorHSelector, separatorVSelector, vbox, xflex, yflex, text, bold, focus, inverted, select
+#include "ftxui/dom/elements.hpp"  // for operator|, Element, reflect, Decorator, nothing, Elements, bgcolor, color, hbox, separatorHSelector, separatorVSelector, vbox, virtualList, xflex, yflex, text, bold, focus, inverted, select
 #include "ftxui/screen/box.hpp"    // for Box
 #include "ftxui/screen/color.hpp"  // for Color
 #include "ftxui/screen/util.hpp"   // for clamp
@@ -71,6 +72,7 @@ class MenuBase : public ComponentBase, public MenuOption {
   explicit MenuBase(const MenuOption& option) : MenuOption(option) {}
 
   bool IsHorizontal() { return ftxui::IsHorizontal(direction); }
+  bool IsVirtualized() { return virtualized() && !IsHorizontal(); }
   void OnChange() {
     if (on_change) {
       on_change();
@@ -87,7 +89,11 @@ class MenuBase : public ComponentBase, public MenuOption {
     if (selected() != selected_previous_) {
       SelectedTakeFocus();
     }
-    boxes_.resize(size());
+    if (IsVirtualized()) {
+      boxes_.clear();
+    } else {
+      boxes_.resize(size());
+    }
     selected() = util::clamp(selected(), 0, size() - 1);
     selected_previous_ = util::clamp(selected_previous_, 0, size() - 1);
     selected_focus_ = util::clamp(selected_focus_, 0, size() - 1);
@@ -97,11 +103,9 @@ class MenuBase : public ComponentBase, public MenuOption {
   void OnAnimation(animation::Params& params) override {
     animator_first_.OnAnimation(params);
     animator_second_.OnAnimation(params);
-    for (auto& animator : animator_background_) {
-      animator.OnAnimation(params);
-    }
-    for (auto& animator : animator_foreground_) {
-      animator.OnAnimation(params);
+    for (auto& [i, animation] : animations_) {
+      animation.animator_background.OnAnimation(params);
+      animation.animator_foreground.OnAnimation(params);
     }
   }
 
@@ -109,44 +113,9 @@ class MenuBase : public ComponentBase, public MenuOption {
     Clamp();
     UpdateAnimationTarget();
 
-    Elements elements;
     const bool is_menu_focused = Focused();
-    if (elements_prefix) {
-      elements.push_back(elements_prefix());
-    }
-    elements.reserve(size());
-    for (int i = 0; i < size(); ++i) {
-      if (i != 0 && elements_infix) {
-        elements.push_back(elements_infix());
-      }
-      const bool is_focused = (focused_entry() == i) && is_menu_focused;
-      const bool is_selected = (selected() == i);
-
-      const EntryState state = {
-          entries[i], false, is_selected, is_focused, i,
-      };
-
-      Element element = (entries_option.transform ? entries_option.transform
-                                                  : DefaultOptionTransform)  //
-          (state);
-      if (selected_focus_ == i) {
-        element |= focus;
-      }
-      element |= AnimatedColorStyle(i);
-      element |= reflect(boxes_[i]);
-      elements.push_back(element);
-    }
-    if (elements_postfix) {
-      elements.push_back(elements_postfix());
-    }
-
-    if (IsInverted(direction)) {
-      std::reverse(elements.begin(), elements.end());
-    }
-
-    const Element bar = IsHorizontal()
-                            ? hbox(std::move(elements), selected_focus_)
-                            : vbox(std::move(elements), selected_focus_);
+    const Element bar = IsVirtualized() ? RenderVirtualized(is_menu_focused)
+                                        : RenderEntries(is_menu_focused);
 
     if (!underline.enabled) {
       return bar | reflect(box_);
@@ -171,6 +140,105 @@ class MenuBase : public ComponentBase, public MenuOption {
     }
   }
 
+  Element RenderEntry(int i, bool is_menu_focused, Box* box) {
+    const bool is_focused = (focused_entry() == i) && is_menu_focused;
+    const bool is_selected = (selected() == i);
+
+    const EntryState state = {
+        entries[i], false, is_selected, is_focused, i,
+    };
+
+    Element element = (entries_option.transform ? entries_option.transform
+                                                : DefaultOptionTransform)  //
+        (state);
+    if (selected_focus_ == i) {
+      element |= focus;
+    }
+    element |= AnimatedColorStyle(i);
+    element |= reflect(*box);
+    return element;
+  }
+
+  Element RenderEntries(bool is_menu_focused) {
+    Elements elements;
+    if (elements_prefix) {
+      elements.push_back(elements_prefix());
+    }
+    elements.reserve(size());
+    for (int i = 0; i < size(); ++i) {
+      if (i != 0 && elements_infix) {
+        elements.push_back(elements_infix());
+      }
+      elements.push_back(RenderEntry(i, is_menu_focused, &boxes_[i]));
+    }
+    if (elements_postfix) {
+      elements.push_back(elements_postfix());
+    }
+
+    if (IsInverted(direction)) {
+      std::reverse(elements.begin(), elements.end());
+    }
+
+    return IsHorizontal() ? hbox(std::move(elements), selected_focus_)
+                          : vbox(std::move(elements), selected_focus_);
+  }
+
+  // Only the entries displayed are built, when the list is laid out. The list
+  // scrolls to the entry focused.
+  Element RenderVirtualized(bool is_menu_focused) {
+    visible_boxes_.clear();
+    const int count = size();
+    const bool inverted = IsInverted(direction);
+    auto row = [this, is_menu_focused, count, inverted](int r) {
+      const int i = inverted ? count - 1 - r : r;
+      return RenderEntry(i, is_menu_focused, &visible_boxes_[i]);
+    };
+    const int focused = inverted ? count - 1 - selected_focus_ : selected_focus_;
+    Element list = virtualList(count, 1, std::move(row), focused);
+    if (!elements_prefix && !elements_postfix) {
+      return list;
+    }
+
+    Elements elements;
+    if (elements_prefix) {
+      elements.push_back(elements_prefix());
+    }
+    elements.push_back(list | yflex);
+    if (elements_postfix) {
+      elements.push_back(elements_postfix());
+    }
+    if (inverted) {
+      std::reverse(elements.begin(), elements.end());
+    }
+    return vbox(std::move(elements));
+  }
+
+  // The entry at (x, y), or -1.
+  int EntryAt(int x, int y) {
+    if (IsVirtualized()) {
+      for (const auto& [i, box] : visible_boxes_) {
+        if (box.Contain(x, y)) {
+          return i;
+        }
+      }
+      return -1;
+    }
+    for (int i = 0; i < int(boxes_.size()); ++i) {
+      if (boxes_[i].Contain(x, y)) {
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  Box SelectedBox() {
+    if (IsVirtualized()) {
+      const auto it = visible_boxes_.find(selected());
+      return it == visible_boxes_.end() ? Box() : it->second;
+    }
+    return boxes_.empty() ? Box() : boxes_[selected()];
+  }
+
   void SelectedTakeFocus() {
     selected_previous_ = selected();
     selected_focus_ = selected();
@@ -307,23 +375,22 @@ class MenuBase : public ComponentBase, public MenuOption {
     if (!CaptureMouse(event)) {
       return false;
     }
-    for (int i = 0; i < size(); ++i) {
-      if (!boxes_[i].Contain(event.mouse().x, event.mouse().y)) {
-        continue;
-      }
+    const int i = EntryAt(event.mouse().x, event.mouse().y);
+    if (i == -1) {
+      return false;
+    }
 
-      TakeFocus();
-      focused_entry() = i;
+    TakeFocus();
+    focused_entry() = i;
 
-      if (event.mouse().button == Mouse::Left &&
-          event.mouse().motion == Mouse::Pressed) {
-        if (selected() != i) {
-          selected() = i;
-          selected_previous_ = selected();
-          OnChange();
-        }
-        return true;
+    if (event.mouse().button == Mouse::Left &&
+        event.mouse().motion == Mouse::Pressed) {
+      if (selected() != i) {
+        selected() = i;
+        selected_previous_ = selected();
+        OnChange();
       }
+      return true;
     }
     return false;
   }
@@ -355,58 +422,63 @@ class MenuBase : public ComponentBase, public MenuOption {
     UpdateUnderlineTarget();
   }
 
+  // Only the selected entry, the focused one, and those still animated have
+  // an animation.
   void UpdateColorTarget() {
-    if (size() != int(animation_background_.size())) {
-      animation_background_.resize(size());
-      animation_foreground_.resize(size());
-      animator_background_.clear();
-      animator_foreground_.clear();
-
-      const int len = size();
-      animator_background_.reserve(len);
-      animator_foreground_.reserve(len);
-      for (int i = 0; i < len; ++i) {
-        animation_background_[i] = 0.F;
-        animation_foreground_[i] = 0.F;
-        animator_background_.emplace_back(&animation_background_[i], 0.F,
-                                          std::chrono::milliseconds(0),
-                                          animation::easing::Linear);
-        animator_foreground_.emplace_back(&animation_foreground_[i], 0.F,
-                                          std::chrono::milliseconds(0),
-                                          animation::easing::Linear);
-      }
+    if (size()) {
+      animations_.try_emplace(selected());
+      animations_.try_emplace(focused_entry());
     }
 
     const bool is_menu_focused = Focused();
-    for (int i = 0; i < size(); ++i) {
+    for (auto it = animations_.begin(); it != animations_.end();) {
+      const int i = it->first;
+      EntryAnimation& animation = it->second;
+      if (i >= size()) {
+        it = animations_.erase(it);
+        continue;
+      }
+
       const bool is_focused = (focused_entry() == i) && is_menu_focused;
       const bool is_selected = (selected() == i);
       float target = is_selected ? 1.F : is_focused ? 0.5F : 0.F;  // NOLINT
-      if (animator_background_[i].to() != target) {
-        animator_background_[i] = animation::Animator(
-            &animation_background_[i], target,
+      if (animation.animator_background.to() != target) {
+        animation.animator_background = animation::Animator(
+            &animation.background, target,
             entries_option.animated_colors.background.duration,
             entries_option.animated_colors.background.function);
-        animator_foreground_[i] = animation::Animator(
-            &animation_foreground_[i], target,
+        animation.animator_foreground = animation::Animator(
+            &animation.foreground, target,
             entries_option.animated_colors.foreground.duration,
             entries_option.animated_colors.foreground.function);
       }
+
+      if (target == 0.F && animation.background == 0.F &&
+          animation.foreground == 0.F) {
+        it = animations_.erase(it);
+      } else {
+        ++it;
+      }
     }
   }
 
   Decorator AnimatedColorStyle(int i) {
+    const auto it = animations_.find(i);
+    const float background =
+        it == animations_.end() ? 0.F : it->second.background;
+    const float foreground =
+        it == animations_.end() ? 0.F : it->second.foreground;
     Decorator style = nothing;
     if (entries_option.animated_colors.foreground.enabled) {
       style = style | color(Color::Interpolate(
-                          animation_foreground_[i],
+                          foreground,
                           entries_option.animated_colors.foreground.inactive,
                           entries_option.animated_colors.foreground.active));
     }
 
     if (entries_option.animated_colors.background.enabled) {
       style = style | bgcolor(Color::Interpolate(
-                          animation_background_[i],
+                          background,
                           entries_option.animated_colors.background.inactive,
                           entries_option.animated_colors.background.active));
     }
@@ -445,19 +517,21 @@ class MenuBase : public ComponentBase, public MenuOption {
   bool Focusable() const final { return entries.size(); }
   int size() const { return int(entries.size()); }
   float FirstTarget() {
-    if (boxes_.empty()) {
+    if (size() == 0) {
       return 0.F;
     }
-    const int value = IsHorizontal() ? boxes_[selected()].x_min - box_.x_min
-                                     : boxes_[selected()].y_min - box_.y_min;
+    const Box box = SelectedBox();
+    const int value =
+        IsHorizontal() ? box.x_min - box_.x_min : box.y_min - box_.y_min;
     return float(value);
   }
   float SecondTarget() {
-    if (boxes_.empty()) {
+    if (size() == 0) {
       return 0.F;
     }
-    const int value = IsHorizontal() ? boxes_[selected()].x_max - box_.x_min
-                                     : boxes_[selected()].y_max - box_.y_min;
+    const Box box = SelectedBox();
+    const int value =
+        IsHorizontal() ? box.x_max - box_.x_min : box.y_max - box_.y_min;
     return float(value);
   }
 
@@ -465,8 +539,10 @@ class MenuBase : public ComponentBase, public MenuOption {
   int selected_previous_ = selected();
   int selected_focus_ = selected();
 
-  // Mouse click support:
+  // Mouse click support. When virtualized, only the entries built by the last
+  // frame have a box.
   std::vector<Box> boxes_;
+  std::map<int, Box> visible_boxes_;
   Box box_;
 
   // Animation support:
@@ -474,10 +550,19 @@ class MenuBase : public ComponentBase, public MenuOption {
   float second_ = 0.F;
   animation::Animator animator_first_ = animation::Animator(&first_, 0.F);
   animation::Animator animator_second_ = animation::Animator(&second_, 0.F);
-  std::vector<animation::Animator> animator_background_;
-  std::vector<animation::Animator> animator_foreground_;
-  std::vector<float> animation_background_;
-  std::vector<float> animation_foreground_;
+
+  // The colors of an entry. An entry without one has its inactive colors.
+  struct EntryAnimation {
+    EntryAnimation() = default;
+    EntryAnimation(const EntryAnimation&) = delete;
+    EntryAnimation& operator=(const EntryAnimation&) = delete;
+
+    float background = 0.F;
+    float foreground = 0.F;
+    animation::Animator animator_background = animation::Animator(&background);
+    animation::Animator animator_foreground = animation::Animator(&foreground);
+  };
+  std::map<int, EntryAnimation> animations_;
 };
 
 /// @brief A list of text. The focused element is selected.
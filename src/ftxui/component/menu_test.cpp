@@ -11,6 +11,7 @@
 #include "ftxui/component/component_base.hpp"     // for ComponentBase
 #include "ftxui/component/component_options.hpp"  // for MenuOption
 #include "ftxui/component/event.hpp"  // for Event, Event::ArrowDown, Event::ArrowLeft, Event::ArrowRight, Event::ArrowUp, Event::Return
+#include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::Left, Mouse::Pressed
 #include "ftxui/dom/node.hpp"         // for Render
 #include "ftxui/screen/screen.hpp"    // for Screen
 #include "ftxui/util/ref.hpp"         // for Ref
@@ -60,7 +61,7 @@ TEST(MenuTest, DirectionDown) {
   Screen screen(4, 3);
   Render(screen, menu->Render());
   EXPECT_EQ(screen.ToString(),
-            "\x1B[1m\x1B[7m> 1 \x1B[22m\x1B[27m\r\n"
+            "\x1B[1;7m> 1 \x1B[0m\r\n"
             "  2 \r\n"
             "  3 ");
 
@@ -87,7 +88,7 @@ TEST(MenuTest, DirectionsUp) {
   EXPECT_EQ(screen.ToString(),
             "  3 \r\n"
             "  2 \r\n"
-            "\x1B[1m\x1B[7m> 1 \x1B[22m\x1B[27m");
+            "\x1B[1;7m> 1 \x1B[0m");
   menu->OnEvent(Event::ArrowDown);
   EXPECT_EQ(selected, 0);
   menu->OnEvent(Event::ArrowUp);
@@ -109,9 +110,7 @@ TEST(MenuTest, DirectionsRight) {
   Screen screen(10, 1);
   Render(screen, menu->Render());
   EXPECT_EQ(screen.ToString(),
-            "\x1B[1m\x1B[7m> 1\x1B[22m\x1B[27m"
-            "  2"
-            "  3 ");
+            "\x1B[1;7m> 1\x1B[0m  2  3 ");
   menu->OnEvent(Event::ArrowLeft);
   EXPECT_EQ(selected, 0);
   menu->OnEvent(Event::ArrowRight);
@@ -133,9 +132,7 @@ TEST(MenuTest, DirectionsLeft) {
   Screen screen(10, 1);
   Render(screen, menu->Render());
   EXPECT_EQ(screen.ToString(),
-            "  3"
-            "  2"
-            "\x1B[1m\x1B[7m> 1\x1B[22m\x1B[27m ");
+            "  3  2\x1B[1;7m> 1\x1B[0m ");
   menu->OnEvent(Event::ArrowRight);
   EXPECT_EQ(selected, 0);
   menu->OnEvent(Event::ArrowLeft);
@@ -159,9 +156,10 @@ TEST(MenuTest, AnimationsHorizontal) {
     Render(screen, menu->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[1m\x1B[7m1\x1B[22m\x1B[27m \x1B[2m2\x1B[22m "
-        "\r\n\x1B[97m\x1B[49m\xE2\x94\x80\x1B[90m\x1B["
-        "49m\xE2\x95\xB6\xE2\x94\x80\xE2\x94\x80\x1B[39m\x1B[49m\r\n    ");
+        "\x1B[1;7m1\x1B[0m \x1B[2m2\x1B[0m \r\n"
+        "\x1B[97m\xE2\x94\x80\x1B[90m\xE2\x95\xB6\xE2\x94\x80\xE2\x94\x80"
+        "\x1B[0m\r\n"
+        "    ");
   }
   selected = 1;
   {
@@ -169,9 +167,10 @@ TEST(MenuTest, AnimationsHorizontal) {
     Render(screen, menu->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[7m1\x1B[27m \x1B[1m2\x1B[22m "
-        "\r\n\x1B[97m\x1B[49m\xE2\x94\x80\x1B[90m\x1B["
-        "49m\xE2\x95\xB6\xE2\x94\x80\xE2\x94\x80\x1B[39m\x1B[49m\r\n    ");
+        "\x1B[7m1\x1B[0m \x1B[1m2\x1B[0m \r\n"
+        "\x1B[97m\xE2\x94\x80\x1B[90m\xE2\x95\xB6\xE2\x94\x80\xE2\x94\x80"
+        "\x1B[0m\r\n"
+        "    ");
   }
   animation::Params params(2s);
   menu->OnAnimation(params);
@@ -180,9 +179,10 @@ TEST(MenuTest, AnimationsHorizontal) {
     Render(screen, menu->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[7m1\x1B[27m \x1B[1m2\x1B[22m "
-        "\r\n\x1B[90m\x1B[49m\xE2\x94\x80\xE2\x95\xB4\x1B[97m\x1B["
-        "49m\xE2\x94\x80\x1B[90m\x1B[49m\xE2\x95\xB6\x1B[39m\x1B[49m\r\n    ");
+        "\x1B[7m1\x1B[0m \x1B[1m2\x1B[0m \r\n"
+        "\x1B[90m\xE2\x94\x80\xE2\x95\xB4\x1B[97m\xE2\x94\x80\x1B[90m\xE2\x95"
+        "\xB6\x1B[0m\r\n"
+        "    ");
   }
 }
 
@@ -195,11 +195,9 @@ TEST(MenuTest, AnimationsVertical) {
     Render(screen, menu->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[90m\x1B[49m\xE2\x94\x82\x1B[1m\x1B[7m\x1B[39m\x1B[49m1\x1B["
-        "22m\x1B[27m        "
-        "\r\n\x1B[97m\x1B[49m\xE2\x95\xB7\x1B[2m\x1B[39m\x1B[49m2\x1B[22m      "
-        "  \r\n\x1B[97m\x1B[49m\xE2\x94\x82\x1B[2m\x1B[39m\x1B[49m3\x1B[22m    "
-        "    ");
+        "\x1B[90m\xE2\x94\x82\x1B[1;7;39m1\x1B[0m        \r\n"
+        "\x1B[97m\xE2\x95\xB7\x1B[2;39m2\x1B[0m        \r\n"
+        "\x1B[97m\xE2\x94\x82\x1B[2;39m3\x1B[0m        ");
   }
   selected = 1;
   {
@@ -207,10 +205,9 @@ TEST(MenuTest, AnimationsVertical) {
     Render(screen, menu->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[90m\x1B[49m\xE2\x94\x82\x1B[7m\x1B[39m\x1B[49m1\x1B[27m        "
-        "\r\n\x1B[97m\x1B[49m\xE2\x95\xB7\x1B[1m\x1B[39m\x1B[49m2\x1B[22m      "
-        "  \r\n\x1B[97m\x1B[49m\xE2\x94\x82\x1B[2m\x1B[39m\x1B[49m3\x1B[22m    "
-        "    ");
+        "\x1B[90m\xE2\x94\x82\x1B[7;39m1\x1B[0m        \r\n"
+        "\x1B[97m\xE2\x95\xB7\x1B[1;39m2\x1B[0m        \r\n"
+        "\x1B[97m\xE2\x94\x82\x1B[2;39m3\x1B[0m        ");
   }
   animation::Params params(2s);
   menu->OnAnimation(params);
@@ -219,10 +216,9 @@ TEST(MenuTest, AnimationsVertical) {
     Render(screen, menu->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[97m\x1B[49m\xE2\x95\xB5\x1B[7m\x1B[39m\x1B[49m1\x1B[27m        "
-        "\r\n\x1B[90m\x1B[49m\xE2\x94\x82\x1B[1m\x1B[39m\x1B[49m2\x1B[22m      "
-        "  \r\n\x1B[97m\x1B[49m\xE2\x95\xB7\x1B[2m\x1B[39m\x1B[49m3\x1B[22m    "
-        "    ");
+        "\x1B[97m\xE2\x95\xB5\x1B[7;39m1\x1B[0m        \r\n"
+        "\x1B[90m\xE2\x94\x82\x1B[1;39m2\x1B[0m        \r\n"
+        "\x1B[97m\xE2\x95\xB7\x1B[2;39m3\x1B[0m        ");
   }
 }
 
@@ -271,5 +267,74 @@ TEST(MenuTest, MenuEntryIndex) {
   }
 }
 
+TEST(MenuTest, Virtualized) {
+  int selected = 500;
+  std::vector<std::string> entries;
+  for (int i = 0; i < 1000; ++i) {
+    entries.push_back(std::to_string(i));
+  }
+  int built = 0;
+  MenuOption option;
+  option.entries = &entries;
+  option.selected = &selected;
+  option.virtualized = true;
+  option.entries_option.transform = [&](const EntryState& state) {
+    built++;
+    return text(state.label);
+  };
+  auto menu = Menu(option);
+
+  // Only the entries displayed are built, around the selected one.
+  Screen screen(4, 3);
+  Render(screen, menu->Render());
+  EXPECT_EQ(built, 3);
+  EXPECT_EQ(screen.ToString(),
+            "499 \r\n"
+            "500 \r\n"
+            "501 ");
+
+  // Click on the last one.
+  Mouse mouse;
+  mouse.button = Mouse::Left;
+  mouse.motion = Mouse::Pressed;
+  mouse.x = 0;
+  mouse.y = 2;
+  EXPECT_TRUE(menu->OnEvent(Event::Mouse("", mouse)));
+  EXPECT_EQ(selected, 501);
+
+  menu->OnEvent(Event::End);
+  EXPECT_EQ(selected, 999);
+  screen.Clear();
+  Render(screen, menu->Render());
+  EXPECT_EQ(screen.ToString(),
+            "997 \r\n"
+            "998 \r\n"
+            "999 ");
+}
+
+TEST(MenuTest, VirtualizedDirectionUp) {
+  int selected = 500;
+  std::vector<std::string> entries;
+  for (int i = 0; i < 1000; ++i) {
+    entries.push_back(std::to_string(i));
+  }
+  MenuOption option;
+  option.entries = &entries;
+  option.selected = &selected;
+  option.direction = Direction::Up;
+  option.virtualized = true;
+  option.entries_option.transform = [](const EntryState& state) {
+    return text(state.label);
+  };
+  auto menu = Menu(option);
+
+  Screen screen(4, 3);
+  Render(screen, menu->Render());
+  EXPECT_EQ(screen.ToString(),
+            "501 \r\n"
+            "500 \r\n"
+            "499 ");
+}
+
 }  // namespace ftxui
 // NOLINTEND
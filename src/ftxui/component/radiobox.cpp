@@ -2,6 +2,7 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include <functional>  // for function
+#include <map>         // for map
 #include <utility>     // for move
 #include <vector>      // for vector
 
@@ -11,7 +12,7 @@
 #include "ftxui/component/event.hpp"  // for Event, Event::ArrowDown, Event::ArrowUp, Event::End, Event::Home, Event::PageDown, Event::PageUp, Event::Return, Event::Tab, Event::TabReverse
 #include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::WheelDown, Mouse::WheelUp, Mouse::Left, Mouse::Released
 #include "ftxui/component/screen_interactive.hpp"  // for Component
-#include "ftxui/dom/elements.hpp"  // for operator|, reflect, Element, vbox, Elements, focus, nothing, select
+#include "ftxui/dom/elements.hpp"  // for operator|, reflect, Element, vbox, virtualList, Elements, focus, nothing, select
 #include "ftxui/screen/box.hpp"   // for Box
 #include "ftxui/screen/util.hpp"  // for clamp
 #include "ftxui/util/ref.hpp"     // for Ref, ConstStringListRef
@@ -30,25 +31,56 @@ class RadioboxBase : public ComponentBase, public RadioboxOption {
  private:
   Element OnRender() override {
     Clamp();
-    Elements elements;
     const bool is_menu_focused = Focused();
+    if (virtualized()) {
+      // Only the entries displayed are built, when the list is laid out.
+      visible_boxes_.clear();
+      auto row = [this, is_menu_focused](int i) {
+        return RenderEntry(i, is_menu_focused, &visible_boxes_[i]);
+      };
+      return virtualList(size(), 1, std::move(row), hovered_) | reflect(box_);
+    }
+
+    Elements elements;
     elements.reserve(size());
     for (int i = 0; i < size(); ++i) {
-      const bool is_focused = (focused_entry() == i) && is_menu_focused;
-      const bool is_selected = (hovered_ == i);
-      auto state = EntryState{
-          entries[i], selected() == i, is_selected, is_focused, i,
-      };
-      auto element =
-          (transform ? transform : RadioboxOption::Simple().transform)(state);
-      if (is_selected) {
-        element |= focus;
-      }
-      elements.push_back(element | reflect(boxes_[i]));
+      elements.push_back(RenderEntry(i, is_menu_focused, &boxes_[i]));
     }
     return vbox(std::move(elements), hovered_) | reflect(box_);
   }
 
+  Element RenderEntry(int i, bool is_menu_focused, Box* box) {
+    const bool is_focused = (focused_entry() == i) && is_menu_focused;
+    const bool is_selected = (hovered_ == i);
+    auto state = EntryState{
+        entries[i], selected() == i, is_selected, is_focused, i,
+    };
+    auto element =
+        (transform ? transform : RadioboxOption::Simple().transform)(state);
+    if (is_selected) {
+      element |= focus;
+    }
+    return element | reflect(*box);
+  }
+
+  // The entry at (x, y), or -1.
+  int EntryAt(int x, int y) {
+    if (virtualized()) {
+      for (const auto& [i, box] : visible_boxes_) {
+        if (box.Contain(x, y)) {
+          return i;
+        }
+      }
+      return -1;
+    }
+    for (int i = 0; i < int(boxes_.size()); ++i) {
+      if (boxes_[i].Contain(x, y)) {
+        return i;
+      }
+    }
+    return -1;
+  }
+
   // NOLINTNEXTLINE(readability-function-cognitive-complexity)
   bool OnEvent(Event event) override {
     Clamp();
@@ -111,22 +143,21 @@ class RadioboxBase : public ComponentBase, public RadioboxOption {
       return OnMouseWheel(event);
     }
 
-    for (int i = 0; i < size(); ++i) {
-      if (!boxes_[i].Contain(event.mouse().x, event.mouse().y)) {
-        continue;
-      }
-
-      TakeFocus();
-      focused_entry() = i;
-      if (event.mouse().button == Mouse::Left &&
-          event.mouse().motion == Mouse::Pressed) {
-        if (selected() != i) {
-          selected() = i;
-          on_change();
-        }
+    const int i = EntryAt(event.mouse().x, event.mouse().y);
+    if (i == -1) {
+      return false;
+    }
 
-        return true;
+    TakeFocus();
+    focused_entry() = i;
+    if (event.mouse().button == Mouse::Left &&
+        event.mouse().motion == Mouse::Pressed) {
+      if (selected() != i) {
+        selected() = i;
+        on_change();
       }
+
+      return true;
     }
     return false;
   }
@@ -155,7 +186,11 @@ class RadioboxBase : public ComponentBase, public RadioboxOption {
   }
 
   void Clamp() {
-    boxes_.resize(size());
+    if (virtualized()) {
+      boxes_.clear();
+    } else {
+      boxes_.resize(size());
+    }
     selected() = util::clamp(selected(), 0, size() - 1);
     focused_entry() = util::clamp(focused_entry(), 0, size() - 1);
     hovered_ = util::clamp(hovered_, 0, size() - 1);
@@ -166,6 +201,7 @@ class RadioboxBase : public ComponentBase, public RadioboxOption {
 
   int hovered_ = selected();
   std::vector<Box> boxes_;
+  std::map<int, Box> visible_boxes_;  // When virtualized.
   Box box_;
 };
 
@@ -1,7 +1,7 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <ftxui/dom/elements.hpp>   // for yframe
+#include <ftxui/dom/elements.hpp>   // for text, yframe
 #include <ftxui/dom/node.hpp>       // for Render
 #include <ftxui/screen/screen.hpp>  // for Screen
 #include <string>                   // for string, basic_string
@@ -11,6 +11,7 @@
 #include "ftxui/component/component_base.hpp"  // for ComponentBase, Component
 #include "ftxui/component/component_options.hpp"  // for RadioboxOption
 #include "ftxui/component/event.hpp"  // for Event, Event::Return, Event::ArrowDown, Event::End, Event::Home, Event::Tab, Event::TabReverse, Event::PageDown, Event::PageUp, Event::ArrowUp
+#include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::Left, Mouse::Pressed
 #include "ftxui/util/ref.hpp"         // for Ref
 #include "gtest/gtest.h"  // for AssertionResult, Message, TestPartResult, EXPECT_EQ, EXPECT_TRUE, Test, EXPECT_FALSE, TEST
 
@@ -305,5 +306,42 @@ TEST(RadioboxTest, RemoveEntries) {
   EXPECT_EQ(focused_entry, 1);
 }
 
+TEST(RadioboxTest, Virtualized) {
+  int selected = 0;
+  std::vector<std::string> entries;
+  for (int i = 0; i < 1000; ++i) {
+    entries.push_back(std::to_string(i));
+  }
+  int built = 0;
+  RadioboxOption option;
+  option.entries = &entries;
+  option.selected = &selected;
+  option.virtualized = true;
+  option.transform = [&](const EntryState& state) {
+    built++;
+    return text(state.label);
+  };
+  auto radiobox = Radiobox(option);
+
+  // Only the entries displayed are built, around the focused one.
+  EXPECT_TRUE(radiobox->OnEvent(Event::End));
+  Screen screen(4, 3);
+  Render(screen, radiobox->Render());
+  EXPECT_EQ(built, 3);
+  EXPECT_EQ(screen.ToString(),
+            "997 \r\n"
+            "998 \r\n"
+            "999 ");
+
+  // Click on the first one.
+  Mouse mouse;
+  mouse.button = Mouse::Left;
+  mouse.motion = Mouse::Pressed;
+  mouse.x = 0;
+  mouse.y = 0;
+  EXPECT_TRUE(radiobox->OnEvent(Event::Mouse("", mouse)));
+  EXPECT_EQ(selected, 997);
+}
+
 }  // namespace ftxui
 // NOLINTEND
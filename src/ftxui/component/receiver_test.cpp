@@ -1,8 +1,10 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
+#include <memory>   // for unique_ptr, make_unique
 #include <thread>   // for thread
-#include <utility>  // for move
+#include <utility>  // for move, pair
+#include <vector>   // for vector
 
 #include "ftxui/component/receiver.hpp"
 #include "gtest/gtest.h"  // for AssertionResult, Message, Test, TestPartResult, EXPECT_EQ, EXPECT_TRUE, EXPECT_FALSE, TEST
@@ -77,5 +79,56 @@ TEST(Receiver, BasicWithThread) {
   t23.join();
 }
 
+TEST(Receiver, MoveOnly) {
+  auto receiver = MakeReceiver<std::unique_ptr<int>>();
+  auto sender = receiver->MakeSender();
+  sender->Send(std::make_unique<int>(1));
+  sender->Send(std::make_unique<int>(2));
+
+  std::unique_ptr<int> value;
+  EXPECT_TRUE(receiver->HasPending());
+  EXPECT_TRUE(receiver->ReceiveNonBlocking(&value));
+  EXPECT_EQ(*value, 1);
+  EXPECT_TRUE(receiver->Receive(&value));
+  EXPECT_EQ(*value, 2);
+  EXPECT_FALSE(receiver->HasPending());
+  EXPECT_FALSE(receiver->ReceiveNonBlocking(&value));
+  EXPECT_FALSE(receiver->HasQuitted());
+  sender.reset();
+  EXPECT_TRUE(receiver->HasQuitted());
+}
+
+TEST(Receiver, ManyProducers) {
+  const int producers = 8;
+  const int count = 10000;
+  auto receiver = MakeReceiver<std::pair<int, int>>();
+
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back(
+        [p](Sender<std::pair<int, int>> sender) {
+          for (int i = 0; i < count; ++i) {
+            sender->Send({p, i});
+          }
+        },
+        receiver->MakeSender());
+  }
+
+  // Every value is received once, in the order sent by its producer.
+  std::vector<int> next(producers, 0);
+  std::pair<int, int> value;
+  int received = 0;
+  while (receiver->Receive(&value)) {
+    EXPECT_EQ(value.second, next[value.first]);
+    next[value.first] = value.second + 1;
+    received++;
+  }
+  EXPECT_EQ(received, producers * count);
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
 }  // namespace ftxui
 // NOLINTEND
@@ -16,7 +16,8 @@
 #include <iostream>  // for cout, ostream, operator<<, basic_ostream, endl, flush
 #include <memory>
 #include <stack>  // for stack
-#include <string>
+#include <string>       // for string
+#include <string_view>  // for string_view
 #include <thread>       // for thread, sleep_for
 #include <tuple>        // for _Swallow_assign, ignore
 #include <type_traits>  // for decay_t
@@ -27,6 +28,7 @@
 #include "ftxui/component/captured_mouse.hpp"  // for CapturedMouse, CapturedMouseInterface
 #include "ftxui/component/component_base.hpp"  // for ComponentBase
 #include "ftxui/component/event.hpp"           // for Event
+#include "ftxui/component/hit_map.hpp"         // for HitMap
 #include "ftxui/component/loop.hpp"            // for Loop
 #include "ftxui/component/receiver.hpp"  // for ReceiverImpl, Sender, MakeReceiver, SenderImpl, Receiver
 #include "ftxui/component/terminal_input_parser.hpp"  // for TerminalInputParser
@@ -47,7 +49,8 @@
 #error Must be compiled in UNICODE mode
 #endif
 #else
-#include <sys/select.h>  // for select, FD_ISSET, FD_SET, FD_ZERO, fd_set, timeval
+#include <fcntl.h>  // for fcntl, F_SETFL, O_NONBLOCK
+#include <poll.h>   // for poll, pollfd, POLLIN
 #include <termios.h>  // for tcsetattr, termios, tcgetattr, TCSANOW, cc_t, ECHO, ICANON, VMIN, VTIME
 #include <unistd.h>  // for STDIN_FILENO, read
 #endif
@@ -77,9 +80,27 @@ void Flush() {
   std::cout << '\0' << std::flush;
 }
 
+std::atomic<int> g_signal_exit_count = 0;  // NOLINT
+#if !defined(_WIN32)
+std::atomic<int> g_signal_stop_count = 0;    // NOLINT
+std::atomic<int> g_signal_resize_count = 0;  // NOLINT
+#endif
+
+// Whether a signal was recorded, and is waiting for the main loop to handle it.
+bool HasPendingSignal() {
+#if !defined(_WIN32)
+  return g_signal_exit_count || g_signal_stop_count || g_signal_resize_count;
+#else
+  return g_signal_exit_count;
+#endif
+}
+
+// A no-op task, waking up the main loop to handle the recorded signals.
+Closure SignalWakeup() {
+  return [] {};
+}
+
 constexpr int timeout_milliseconds = 20;
-[[maybe_unused]] constexpr int timeout_microseconds =
-    timeout_milliseconds * 1000;
 #if defined(_WIN32)
 
 void EventListener(std::atomic<bool>* quit, Sender<Task> out) {
@@ -91,6 +112,9 @@ void EventListener(std::atomic<bool>* quit, Sender<Task> out) {
     auto wait_result = WaitForSingleObject(console, timeout_milliseconds);
     if (wait_result == WAIT_TIMEOUT) {
       parser.Timeout(timeout_milliseconds);
+      if (HasPendingSignal()) {
+        out->Send(SignalWakeup());
+      }
       continue;
     }
 
@@ -115,9 +139,7 @@ void EventListener(std::atomic<bool>* quit, Sender<Task> out) {
             continue;
           std::wstring wstring;
           wstring += key_event.uChar.UnicodeChar;
-          for (auto it : to_string(wstring)) {
-            parser.Add(it);
-          }
+          parser.Add(to_string(wstring));
         } break;
         case WINDOW_BUFFER_SIZE_EVENT:
           out->Send(Event::Special({0}));
@@ -137,7 +159,7 @@ void EventListener(std::atomic<bool>* quit, Sender<Task> out) {
 
 // Read char from the terminal.
 void EventListener(std::atomic<bool>* quit, Sender<Task> out) {
-  auto parser = TerminalInputParser(std::move(out));
+  auto parser = TerminalInputParser(out->Clone());
 
   char c;
   while (!*quit) {
@@ -146,6 +168,9 @@ void EventListener(std::atomic<bool>* quit, Sender<Task> out) {
 
     emscripten_sleep(1);
     parser.Timeout(1);
+    if (HasPendingSignal()) {
+      out->Send(SignalWakeup());
+    }
   }
 }
 
@@ -162,30 +187,76 @@ void ftxui_on_resize(int columns, int rows) {
 
 #else  // POSIX (Linux & Mac)
 
-int CheckStdinReady(int usec_timeout) {
-  timeval tv = {0, usec_timeout};  // NOLINT
-  fd_set fds;
-  FD_ZERO(&fds);                                          // NOLINT
-  FD_SET(STDIN_FILENO, &fds);                             // NOLINT
-  select(STDIN_FILENO + 1, &fds, nullptr, nullptr, &tv);  // NOLINT
-  return FD_ISSET(STDIN_FILENO, &fds);                    // NOLINT
+// A pipe written to wake up the EventListener: when the screen is uninstalled,
+// or when a signal is received.
+std::array<int, 2> g_wakeup_pipe = {-1, -1};  // NOLINT
+
+void OpenWakeupPipe() {
+  if (pipe(g_wakeup_pipe.data()) != 0) {
+    g_wakeup_pipe = {-1, -1};
+    return;
+  }
+  for (const int fd : g_wakeup_pipe) {
+    fcntl(fd, F_SETFL, O_NONBLOCK);  // NOLINT
+  }
 }
 
-// Read char from the terminal.
+// Async signal safe function
+void WakeUpEventListener() {
+  if (g_wakeup_pipe[1] != -1) {
+    const char c = 0;
+    std::ignore = write(g_wakeup_pipe[1], &c, 1);
+  }
+}
+
+void CloseWakeupPipe() {
+  for (int& fd : g_wakeup_pipe) {
+    if (fd != -1) {
+      close(fd);
+      fd = -1;
+    }
+  }
+}
+
+// Read char from the terminal. Sleep until there is some input, an escape
+// sequence waiting to time out, or a wakeup.
 void EventListener(std::atomic<bool>* quit, Sender<Task> out) {
-  auto parser = TerminalInputParser(std::move(out));
+  auto parser = TerminalInputParser(out->Clone());
 
+  std::array<pollfd, 2> fds = {{
+      {STDIN_FILENO, POLLIN, 0},
+      {g_wakeup_pipe[0], POLLIN, 0},
+  }};
+  std::array<char, 4096> buffer;  // NOLINT
   while (!*quit) {
-    if (!CheckStdinReady(timeout_microseconds)) {
-      parser.Timeout(timeout_milliseconds);
+    // Without a wakeup pipe, poll regularly to notice |quit| and signals.
+    const bool poll_regularly = parser.HasPending() || g_wakeup_pipe[0] == -1;
+    const int timeout = poll_regularly ? timeout_milliseconds : -1;
+    const int ready = poll(fds.data(), fds.size(), timeout);
+    if (ready < 0) {
       continue;
     }
+    if (ready == 0) {
+      parser.Timeout(timeout_milliseconds);
+    }
 
-    const size_t buffer_size = 100;
-    std::array<char, buffer_size> buffer;                        // NOLINT;
-    size_t l = read(fileno(stdin), buffer.data(), buffer_size);  // NOLINT
-    for (size_t i = 0; i < l; ++i) {
-      parser.Add(buffer[i]);  // NOLINT
+    if (fds[1].revents & POLLIN) {  // NOLINT
+      while (read(g_wakeup_pipe[0], buffer.data(), buffer.size()) > 0) {
+      }
+    }
+    if (!*quit && HasPendingSignal()) {
+      out->Send(SignalWakeup());
+    }
+
+    if (fds[0].revents & (POLLIN | POLLHUP)) {  // NOLINT
+      const ssize_t l = read(STDIN_FILENO, buffer.data(), buffer.size());
+      if (l == 0) {
+        // End of file, stop watching stdin.
+        fds[0].fd = -1;
+      }
+      if (l > 0) {
+        parser.Add(std::string_view(buffer.data(), size_t(l)));
+      }
     }
   }
 }
@@ -199,11 +270,6 @@ void OnExit() {
   }
 }
 
-std::atomic<int> g_signal_exit_count = 0;  // NOLINT
-#if !defined(_WIN32)
-std::atomic<int> g_signal_stop_count = 0;    // NOLINT
-std::atomic<int> g_signal_resize_count = 0;  // NOLINT
-#endif
 
 // Async signal safe function
 void RecordSignal(int signal) {
@@ -230,6 +296,10 @@ void RecordSignal(int signal) {
     default:
       break;
   }
+
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+  WakeUpEventListener();
+#endif
 }
 
 void ExecuteSignalHandlers() {
@@ -286,6 +356,7 @@ enum class DECMode : std::uint16_t {
   kMouseUrxvtMode = 1015,
   kMouseSgrPixelsMode = 1016,
   kAlternateScreen = 1049,
+  kBracketedPaste = 2004,
 };
 
 // Device Status Report (DSR) {
@@ -335,12 +406,16 @@ class CapturedMouseImpl : public CapturedMouseInterface {
   std::function<void(void)> callback_;
 };
 
-void AnimationListener(std::atomic<bool>* quit, Sender<Task> out) {
-  // Animation at around 60fps.
+// Sleep until an animation frame is requested, and send it about 15ms later,
+// for animations to run at around 60fps.
+void AnimationListener(std::atomic<bool>* quit,
+                       Receiver<bool> requests,
+                       Sender<Task> out) {
   const auto time_delta = std::chrono::milliseconds(15);
-  while (!*quit) {
-    out->Send(AnimationTask());
+  bool request = false;
+  while (requests->Receive(&request) && !*quit) {
     std::this_thread::sleep_for(time_delta);
+    out->Send(AnimationTask());
   }
 }
 
@@ -356,6 +431,8 @@ ScreenInteractive::ScreenInteractive(int dimx,
   task_receiver_ = MakeReceiver<Task>();
 }
 
+ScreenInteractive::~ScreenInteractive() = default;
+
 // static
 ScreenInteractive ScreenInteractive::FixedSize(int dimx, int dimy) {
   return {
@@ -442,6 +519,170 @@ void ScreenInteractive::TrackMouse(bool enable) {
   track_mouse_ = enable;
 }
 
+/// @ingroup component
+/// @brief Set whether the terminal sends a paste at once, delivered as a
+/// single `Event::Paste`, instead of one event per character.
+/// @param enable Whether to enable bracketed paste.
+/// @note This must be called outside of the main loop. E.g. before calling
+/// `ScreenInteractive::Loop`.
+/// @note Bracketed paste is enabled by default. A paste not handled by the
+/// component is delivered again as its characters, one by one.
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::TerminalOutput();
+/// screen.BracketedPaste(false);
+/// screen.Loop(component);
+/// ```
+void ScreenInteractive::BracketedPaste(bool enable) {
+  bracketed_paste_ = enable;
+}
+
+/// @ingroup component
+/// @brief Set whether only the cells modified since the previous frame are sent
+/// to the terminal.
+/// @param enable Whether to enable differential rendering.
+/// @note This must be called outside of the main loop. E.g. before calling
+/// `ScreenInteractive::Loop`.
+/// @note Differential rendering is enabled by default. It applies only to the
+/// alternate screen, where the frame is anchored to the top-left corner of the
+/// terminal.
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::Fullscreen();
+/// screen.DifferentialRendering(false);
+/// screen.Loop(component);
+/// ```
+void ScreenInteractive::DifferentialRendering(bool enable) {
+  differential_rendering_ = enable;
+}
+
+/// @ingroup component
+/// @brief Allocate the elements built for every frame from an arena, instead
+/// of allocating each of them on the heap. Its memory is reused by the next
+/// frame.
+///
+/// @note Elements kept across frames remain valid. The memory they use is only
+/// reused once they are all destroyed.
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::Fullscreen();
+/// screen.UseFrameArena();
+/// screen.Loop(component);
+/// ```
+void ScreenInteractive::UseFrameArena(bool enable) {
+  use_frame_arena_ = enable;
+}
+
+/// @ingroup component
+/// @brief Render the frames using |threads| threads, including the one running
+/// the loop. The children of hbox, vbox and gridbox are then rendered
+/// concurrently. The default, 1, renders on the thread of the loop only.
+///
+/// @note Useful for big screens, whose elements are costly to render, like
+/// canvas or graph.
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::Fullscreen();
+/// screen.RenderThreads(4);
+/// screen.Loop(component);
+/// ```
+void ScreenInteractive::RenderThreads(int threads) {
+  if (threads <= 1) {
+    render_pool_.reset();
+    return;
+  }
+  render_pool_ = std::make_unique<RenderPool>(threads);
+}
+
+/// @ingroup component
+/// @brief Route the mouse events using the components drawn in the last frame.
+/// A mouse event is then only delivered to the components on the path to the
+/// topmost component under the mouse, and to the ones on the path of the
+/// previous mouse event. The others aren't visited: with many components,
+/// moving the mouse no longer walks the whole tree.
+///
+/// @note The components forwarding their mouse events with
+/// `ComponentBase::OnEvent` are routed. Those reacting to a click outside of
+/// themselves, like `Dropdown` closing itself, don't receive it anymore. While
+/// the mouse is captured, the events are delivered to every component.
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::Fullscreen();
+/// screen.MouseHitTesting();
+/// screen.Loop(component);
+/// ```
+void ScreenInteractive::MouseHitTesting(bool enable) {
+  if (!enable) {
+    hit_map_.reset();
+    return;
+  }
+  if (!hit_map_) {
+    hit_map_ = std::make_unique<HitMap>();
+  }
+}
+
+/// @ingroup component
+/// @brief Record how long each phase of the last |frames| frames took, and how
+/// much work it did. See FrameProfiler.
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::Fullscreen();
+/// screen.EnableProfiler();
+/// screen.Profiler()->OnFrame([](const FrameProfile& profile) {
+///   // Log the slow frames...
+/// });
+/// screen.Loop(component);
+/// ```
+void ScreenInteractive::EnableProfiler(size_t frames) {
+  profiler_ = std::make_unique<FrameProfiler>(frames);
+  profile_ = FrameProfile();
+}
+
+/// @ingroup component
+/// @brief Stop recording the profile of the frames.
+void ScreenInteractive::DisableProfiler() {
+  profiler_.reset();
+}
+
+/// @ingroup component
+/// @brief Limit how often a new frame is drawn. Events arriving in between are
+/// still handled, and coalesced into the next frame.
+/// @param fps The maximum number of frames per second. Zero, the default,
+/// means no limit.
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::Fullscreen();
+/// screen.MaxFrameRate(30);
+/// screen.Loop(component);
+/// ```
+void ScreenInteractive::MaxFrameRate(float fps) {
+  min_frame_interval_ =
+      fps > 0.F ? animation::Duration(1.F / fps) : animation::Duration(0);
+}
+
+/// @ingroup component
+/// @brief Set the longest time spent handling pending tasks before drawing a
+/// frame. The remaining tasks are handled after the frame. This keeps the
+/// screen updating during a flood of events, e.g. a large paste.
+/// @param duration The time slice. It is 16ms by default.
+void ScreenInteractive::TaskTimeSlice(animation::Duration duration) {
+  task_time_slice_ = duration;
+}
+
 /// @brief Add a task to the main loop.
 /// It will be executed later, after every other scheduled tasks.
 /// @ingroup component
@@ -474,6 +715,9 @@ void ScreenInteractive::RequestAnimationFrame() {
   if (now - previous_animation_time_ >= time_histeresis) {
     previous_animation_time_ = now;
   }
+  if (animation_request_sender_) {
+    animation_request_sender_->Send(true);
+  }
 }
 
 /// @brief Try to get the unique lock about behing able to capture the mouse.
@@ -599,6 +843,9 @@ ScreenInteractive* ScreenInteractive::Active() {
 void ScreenInteractive::Install() {
   frame_valid_ = false;
 
+  // The terminal content is unknown, the next frame must be drawn entirely.
+  presented_ = Screen(0, 0);
+
   // Flush the buffer for stdout to ensure whatever the user has printed before
   // is fully applied before we start modifying the terminal configuration. This
   // is important, because we are using two different channels (stdout vs
@@ -662,6 +909,14 @@ void ScreenInteractive::Install() {
     InstallSignalHandler(signal);
   }
 
+  // SIGWINCH reports every resize of the terminal from now on. Its size no
+  // longer needs to be queried every frame. A screen installed by an outer
+  // loop keeps caching it once this one exits.
+  const bool size_cached = Terminal::SizeCached();
+  Terminal::CacheSize(true);
+  on_exit_functions.emplace(
+      [size_cached] { Terminal::CacheSize(size_cached); });
+
   struct termios terminal;  // NOLINT
   tcgetattr(STDIN_FILENO, &terminal);
   on_exit_functions.emplace(
@@ -725,16 +980,31 @@ void ScreenInteractive::Install() {
     enable({DECMode::kMouseSgrExtMode});
   }
 
+  if (bracketed_paste_) {
+    enable({DECMode::kBracketedPaste});
+  }
+
   // After installing the new configuration, flush it to the terminal to
   // ensure it is fully applied:
   Flush();
 
   quit_ = false;
   task_sender_ = task_receiver_->MakeSender();
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+  OpenWakeupPipe();
+#endif
   event_listener_ =
       std::thread(&EventListener, &quit_, task_receiver_->MakeSender());
+
+  auto animation_requests = MakeReceiver<bool>();
+  animation_request_sender_ = animation_requests->MakeSender();
   animation_listener_ =
-      std::thread(&AnimationListener, &quit_, task_receiver_->MakeSender());
+      std::thread(&AnimationListener, &quit_, std::move(animation_requests),
+                  task_receiver_->MakeSender());
+  // Animation frames requested before the loop started.
+  if (animation_requested_) {
+    animation_request_sender_->Send(true);
+  }
 }
 
 // private
@@ -742,6 +1012,9 @@ void ScreenInteractive::Uninstall() {
   ExitNow();
   event_listener_.join();
   animation_listener_.join();
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+  CloseWakeupPipe();
+#endif
   OnExit();
 }
 
@@ -749,21 +1022,35 @@ void ScreenInteractive::Uninstall() {
 // NOLINTNEXTLINE
 void ScreenInteractive::RunOnceBlocking(Component component) {
   ExecuteSignalHandlers();
-  Task task;
-  if (task_receiver_->Receive(&task)) {
-    HandleTask(component, task);
+  if (frame_valid_) {
+    Task task;
+    if (task_receiver_->Receive(&task)) {
+      HandleTask(component, task);
+    }
+  } else {
+    // A frame was delayed by the frame rate limit. Wait for its turn, then
+    // handle everything received meanwhile.
+    std::this_thread::sleep_until(next_frame_time_);
   }
   RunOnce(component);
 }
 
 // private
 void ScreenInteractive::RunOnce(Component component) {
+  const auto deadline =
+      animation::Clock::now() +
+      std::chrono::duration_cast<animation::Clock::duration>(task_time_slice_);
   Task task;
   while (task_receiver_->ReceiveNonBlocking(&task)) {
     HandleTask(component, task);
     ExecuteSignalHandlers();
+    if (animation::Clock::now() >= deadline) {
+      break;
+    }
+  }
+  if (animation::Clock::now() >= next_frame_time_) {
+    Draw(std::move(component));
   }
-  Draw(std::move(component));
 
   if (selection_data_previous_ != selection_data_) {
     selection_data_previous_ = selection_data_;
@@ -777,6 +1064,8 @@ void ScreenInteractive::RunOnce(Component component) {
 // private
 // NOLINTNEXTLINE
 void ScreenInteractive::HandleTask(Component component, Task& task) {
+  const auto start =
+      profiler_ ? FrameProfile::Clock::now() : FrameProfile::Clock::time_point();
   std::visit(
       [&](auto&& arg) {
         using T = std::decay_t<decltype(arg)>;
@@ -802,8 +1091,21 @@ void ScreenInteractive::HandleTask(Component component, Task& task) {
 
       arg.screen_ = this;
 
+      // A captured mouse is delivered to every component, but the path still
+      // tells the next event which components the mouse has left.
+      const bool route = hit_map_ && arg.is_mouse();
+      if (route) {
+        hit_map_->Route(arg.mouse().x, arg.mouse().y);
+      }
+      const HitMap::RouteScope route_scope(
+          route && !mouse_captured ? hit_map_.get() : nullptr);
+
       bool handled = component->OnEvent(arg);
 
+      if (!handled && arg.is_paste()) {
+        handled = HandlePasteAsCharacters(component, arg);
+      }
+
       handled = HandleSelection(handled, arg);
 
       if (arg == Event::CtrlC && (!handled || force_handle_ctrl_c_)) {
@@ -815,8 +1117,8 @@ void ScreenInteractive::HandleTask(Component component, Task& task) {
         RecordSignal(SIGTSTP);
       }
 #endif
-      
-      frame_valid_ = false;
+
+      InvalidateFrame();
       return;
     }
 
@@ -839,12 +1141,41 @@ void ScreenInteractive::HandleTask(Component component, Task& task) {
 
       animation::Params params(delta);
       component->OnAnimation(params);
-      frame_valid_ = false;
+      InvalidateFrame();
       return;
     }
   },
   task);
   // clang-format on
+
+  if (profiler_) {
+    profile_.tasks += FrameProfile::Clock::now() - start;
+    profile_.tasks_handled++;
+  }
+}
+
+// private
+// Deliver a paste as the events the terminal sends without bracketed paste,
+// for the components not handling Event::Paste.
+bool ScreenInteractive::HandlePasteAsCharacters(Component& component,
+                                                const Event& paste) {
+  auto receiver = MakeReceiver<Task>();
+  {
+    TerminalInputParser parser(receiver->MakeSender());
+    parser.Add(paste.paste());
+
+    // Nothing follows the paste: deliver an incomplete sequence at its end,
+    // e.g. a lone ESC, like a terminal timing it out does.
+    parser.Timeout(50);  // NOLINT
+  }
+  bool handled = false;
+  Task task;
+  while (receiver->Receive(&task)) {
+    Event event = std::get<Event>(task);
+    event.screen_ = this;
+    handled |= component->OnEvent(event);
+  }
+  return handled;
 }
 
 // private
@@ -906,11 +1237,43 @@ void ScreenInteractive::Draw(Component component) {
   if (frame_valid_)
     return;
 
-  auto document = component->Render();
+  // The elements of the previous frame are destroyed by now.
+  if (hit_map_) {
+    hit_map_->Clear();
+  }
+  frame_arena_.Reset();
+  const FrameArena::Scope arena_scope(use_frame_arena_ ? &frame_arena_
+                                                       : nullptr);
+  const RenderPool::Scope pool_scope(render_pool_.get());
+
+  // When profiling, the time elapsed since the previous lap is added to the
+  // phases of the frame. Render() measures its own steps.
+  const RenderProfile::Scope profile_scope(profiler_ ? &profile_.render
+                                                     : nullptr);
+  const auto frame_start =
+      profiler_ ? FrameProfile::Clock::now() : FrameProfile::Clock::time_point();
+  auto lap_start = frame_start;
+  const auto lap = [&] {
+    const auto now = FrameProfile::Clock::now();
+    const auto elapsed = now - lap_start;
+    lap_start = now;
+    return elapsed;
+  };
+
+  Element document;
+  {
+    // The focus of the components doesn't change while they are rendered.
+    const ComponentBase::FocusScope focus_scope;
+    const HitMap::Scope hit_map_scope(hit_map_.get());
+    document = component->Render();
+  }
+  if (profiler_) {
+    profile_.component += lap();
+  }
   int dimx = 0;
   int dimy = 0;
   auto terminal = Terminal::Size();
-  document->ComputeRequirement();
+  document->ComputeRequirementCached();
   switch (dimension_) {
     case Dimension::Fixed:
       dimx = dimx_;
@@ -929,10 +1292,19 @@ void ScreenInteractive::Draw(Component component) {
       dimy = util::clamp(document->requirement().min_y, 0, terminal.dimy);
       break;
   }
+  if (profiler_) {
+    profile_.render.layout += lap();
+  }
 
   const bool resized = (dimx != dimx_) || (dimy != dimy_);
+  const bool differential = differential_rendering_ &&
+                            use_alternative_screen_ && !resized &&
+                            presented_.width() == dimx &&
+                            presented_.height() == dimy;
   ResetCursorPosition();
-  std::cout << ResetPosition(/*clear=*/resized);
+  if (!differential) {
+    std::cout << ResetPosition(/*clear=*/resized);
+  }
 
   // If the terminal width decrease, the terminal emulator will start wrapping
   // lines and make the display dirty. We should clear it completely.
@@ -947,7 +1319,18 @@ void ScreenInteractive::Draw(Component component) {
     dimy_ = dimy;
     cursor_.x = dimx_ - 1;
     cursor_.y = dimy_ - 1;
-    pixels_.resize(dimx_ * dimy_);
+    // Grow with some headroom, and shrink only once much smaller, so that
+    // resizing the terminal step by step doesn't reallocate every frame.
+    const size_t size = size_t(dimx_) * size_t(dimy_);
+    if (size > pixels_.capacity()) {
+      pixels_.reserve(size + size / 4);
+    } else if (size < pixels_.capacity() / 4) {
+      pixels_.resize(size);
+      pixels_.shrink_to_fit();
+    }
+    pixels_.resize(size);
+    data_ = pixels_.data();
+    dirty_rows_.assign(dimy_, 1);
   }
 
   // Periodically request the terminal emulator the frame position relative to
@@ -981,6 +1364,12 @@ void ScreenInteractive::Draw(Component component) {
                          selection_data_.start_x, selection_data_.start_y,  //
                          selection_data_.end_x, selection_data_.end_y);
   Render(*this, document.get(), *selection_);
+  if (hit_map_) {
+    hit_map_->Paint(dimx_, dimy_);
+  }
+  if (profiler_) {
+    lap();
+  }
 
   // Set cursor position for user using tools to insert CJK characters.
   {
@@ -1009,10 +1398,46 @@ void ScreenInteractive::Draw(Component component) {
     }
   }
 
-  std::cout << ToString() << set_cursor_position;
+  if (differential) {
+    ToStringDiff(presented_, output_);
+  } else {
+    ToString(output_);
+  }
+  if (profiler_) {
+    profile_.serialize += lap();
+    profile_.bytes = output_.size() + set_cursor_position.size();
+  }
+  std::cout << output_ << set_cursor_position;
   Flush();
+  if (profiler_) {
+    profile_.output += lap();
+  }
+  if (differential_rendering_ && use_alternative_screen_) {
+    presented_ = *this;
+  }
   Clear();
   frame_valid_ = true;
+  frames_presented_++;
+  next_frame_time_ =
+      animation::Clock::now() +
+      std::chrono::duration_cast<animation::Clock::duration>(
+          min_frame_interval_);
+
+  if (profiler_) {
+    profile_.frame = frames_presented_;
+    profile_.total = FrameProfile::Clock::now() - frame_start;
+    profiler_->Record(profile_);
+    profile_ = FrameProfile();
+  }
+}
+
+// private
+void ScreenInteractive::InvalidateFrame() {
+  // The frame was already invalid: the two updates are drawn as one.
+  if (!frame_valid_) {
+    frames_skipped_++;
+  }
+  frame_valid_ = false;
 }
 
 // private
@@ -1037,6 +1462,12 @@ void ScreenInteractive::Exit() {
 void ScreenInteractive::ExitNow() {
   quit_ = true;
   task_sender_.reset();
+
+  // Wake up the listeners, so that they quit and release their senders.
+  animation_request_sender_.reset();
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+  WakeUpEventListener();
+#endif
 }
 
 // private:
@@ -1063,6 +1494,7 @@ void ScreenInteractive::Signal(int signal) {
   }
 
   if (signal == SIGWINCH) {
+    Terminal::RefreshSize();
     Post(Event::Special({0}));
     return;
   }
@@ -2,11 +2,18 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include <gtest/gtest.h>  // for Test, TestInfo (ptr only), TEST, EXPECT_EQ, Message, TestPartResult
+#include <chrono>  // for milliseconds, seconds
 #include <csignal>  // for raise, SIGABRT, SIGFPE, SIGILL, SIGINT, SIGSEGV, SIGTERM
+#if !defined(_WIN32)
+#include <sys/resource.h>  // for getrusage, rusage, RUSAGE_SELF
+#endif
 #include <ftxui/component/event.hpp>  // for Event, Event::Custom
+#include <thread>                     // for thread, sleep_for
 #include <tuple>                      // for _Swallow_assign, ignore
+#include <vector>                     // for vector
 
-#include "ftxui/component/component.hpp"  // for Renderer
+#include "ftxui/component/component.hpp"  // for Renderer, CatchEvent
+#include "ftxui/component/loop.hpp"       // for Loop
 #include "ftxui/component/screen_interactive.hpp"
 #include "ftxui/dom/elements.hpp"  // for text, Element
 
@@ -131,4 +138,147 @@ TEST(ScreenInteractive, CtrlC_NotForced) {
   ASSERT_GE(ctrl_c_count, 50);
 }
 
+TEST(ScreenInteractive, CoalesceBurst) {
+  auto screen = ScreenInteractive::FixedSize(10, 1);
+  screen.TaskTimeSlice(std::chrono::seconds(10));
+  int render = 0;
+  auto component = Renderer([&] {
+    render++;
+    return text("");
+  });
+
+  Loop loop(&screen, component);
+  for (int i = 0; i < 10000; ++i) {
+    screen.PostEvent(Event::Custom);
+  }
+  loop.RunOnce();
+
+  // The 10000 events are merged into the first frame.
+  EXPECT_EQ(render, 1);
+  EXPECT_EQ(screen.FramesPresented(), 1u);
+  EXPECT_EQ(screen.FramesSkipped(), 10000u);
+}
+
+TEST(ScreenInteractive, TaskTimeSlice) {
+  auto screen = ScreenInteractive::FixedSize(10, 1);
+  screen.TaskTimeSlice(std::chrono::milliseconds(0));
+  int render = 0;
+  auto component = Renderer([&] {
+    render++;
+    return text("");
+  });
+
+  Loop loop(&screen, component);
+  screen.PostEvent(Event::Custom);
+  screen.PostEvent(Event::Custom);
+  screen.PostEvent(Event::Custom);
+
+  // A frame is drawn after every task, as the time slice is exhausted.
+  loop.RunOnce();
+  EXPECT_EQ(render, 1);
+  loop.RunOnce();
+  EXPECT_EQ(render, 2);
+  loop.RunOnce();
+  EXPECT_EQ(render, 3);
+  EXPECT_EQ(screen.FramesPresented(), 3u);
+}
+
+TEST(ScreenInteractive, MaxFrameRate) {
+  auto screen = ScreenInteractive::FixedSize(10, 1);
+  screen.MaxFrameRate(10);
+
+  // Flood the screen with events for 300ms.
+  auto flood = [&] {
+    const auto start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start <
+           std::chrono::milliseconds(300)) {
+      screen.PostEvent(Event::Custom);
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    screen.Exit();
+  };
+
+  int render = 0;
+  std::thread producer;
+  auto component = Renderer([&] {
+    if (render++ == 0) {
+      producer = std::thread(flood);
+    }
+    return text("");
+  });
+  screen.Loop(component);
+  producer.join();
+
+  // At 10 frames per second, at most 4 frames are drawn in 300ms, plus the
+  // final one.
+  EXPECT_LE(render, 5);
+  EXPECT_EQ(screen.FramesPresented(), size_t(render));
+  EXPECT_GT(screen.FramesSkipped(), 0u);
+}
+
+#if !defined(_WIN32)
+// An idle screen sleeps until something happens, instead of polling.
+TEST(ScreenInteractive, IdleWakeups) {
+  auto screen = ScreenInteractive::FixedSize(10, 1);
+  auto component = Renderer([] { return text("idle"); });
+
+  Loop loop(&screen, component);
+  loop.RunOnce();
+
+  auto context_switches = [] {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_nvcsw;
+  };
+  const auto context_switches_before = context_switches();
+
+  std::thread exit([&] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    screen.Exit();
+  });
+  int wakeups = 0;
+  while (!loop.HasQuitted()) {
+    loop.RunOnceBlocking();
+    wakeups++;
+  }
+  exit.join();
+
+  // The loop only wakes up to exit. Polling every 20ms would have caused about
+  // 25 wakeups per thread.
+  EXPECT_LE(wakeups, 2);
+  EXPECT_LE(context_switches() - context_switches_before, 10);
+}
+#endif
+
+TEST(ScreenInteractive, PasteAsCharacters) {
+  auto screen = ScreenInteractive::FixedSize(2, 2);
+  std::vector<Event> events;
+  auto component = Renderer([] { return text(""); }) |
+                   CatchEvent([&](Event event) {
+                     if (event.is_paste()) {
+                       return false;
+                     }
+                     events.push_back(event);
+                     return true;
+                   });
+
+  // The paste isn't handled: its characters are delivered one by one.
+  Loop loop(&screen, component);
+  screen.PostEvent(Event::Paste("ab\r\xC3\xA9"));
+  loop.RunOnce();
+  ASSERT_EQ(events.size(), 4u);
+  EXPECT_EQ(events[0], Event::Character('a'));
+  EXPECT_EQ(events[1], Event::Character('b'));
+  EXPECT_EQ(events[2], Event::Return);
+  EXPECT_EQ(events[3], Event::Character("\xC3\xA9"));
+
+  // A paste ending with an incomplete sequence.
+  events.clear();
+  screen.PostEvent(Event::Paste("a\x1B"));
+  loop.RunOnce();
+  ASSERT_EQ(events.size(), 2u);
+  EXPECT_EQ(events[0], Event::Character('a'));
+  EXPECT_EQ(events[1], Event::Escape);
+}
+
 }  // namespace ftxui
@@ -3,29 +3,40 @@
 // the LICENSE file.
 #include "ftxui/component/terminal_input_parser.hpp"
 
+#include <algorithm>                  // for lower_bound, max, min
 #include <cstdint>                    // for uint32_t
 #include <ftxui/component/mouse.hpp>  // for Mouse, Mouse::Button, Mouse::Motion
 #include <ftxui/component/receiver.hpp>  // for SenderImpl, Sender
-#include <map>
-#include <memory>   // for unique_ptr, allocator
-#include <utility>  // for move
-#include <vector>
+#include <iterator>                      // for begin, end, size
+#include <memory>                        // for unique_ptr, allocator
+#include <string>                        // for string
+#include <string_view>                   // for string_view
+#include <utility>                       // for move
+#include <vector>                        // for vector
 #include "ftxui/component/event.hpp"  // for Event
 #include "ftxui/component/task.hpp"   // for Task
 
 namespace ftxui {
 
+namespace {
+
+struct Uniformized {
+  std::string_view from;
+  std::string_view to;
+};
+
+// Sorted by |from|, for a binary search.
 // NOLINTNEXTLINE
-const std::map<std::string, std::string> g_uniformize = {
+constexpr Uniformized g_uniformize[] = {
+    // See: https://github.com/ArthurSonzogni/FTXUI/issues/508
+    {"\x08", "\x7F"},
+
     // Microsoft's terminal uses a different new line character for the return
     // key. This also happens with linux with the `bind` command:
     // See https://github.com/ArthurSonzogni/FTXUI/issues/337
     // Here, we uniformize the new line character to `\n`.
     {"\r", "\n"},
 
-    // See: https://github.com/ArthurSonzogni/FTXUI/issues/508
-    {std::string({8}), std::string({127})},
-
     // See: https://github.com/ArthurSonzogni/FTXUI/issues/626
     //
     // Depending on the Cursor Key Mode (DECCKM), the terminal sends different
@@ -44,37 +55,28 @@ const std::map<std::string, std::string> g_uniformize = {
     {"\x1BOB", "\x1B[B"},  // DOWN
     {"\x1BOC", "\x1B[C"},  // RIGHT
     {"\x1BOD", "\x1B[D"},  // LEFT
-    {"\x1BOH", "\x1B[H"},  // HOME
     {"\x1BOF", "\x1B[F"},  // END
+    {"\x1BOH", "\x1B[H"},  // HOME
 
     // Variations around the FN keys.
     // Internally, we are using:
     // vt220, xterm-vt200, xterm-xf86-v44, xterm-new, mgt, screen
     // See: https://invisible-island.net/xterm/xterm-function-keys.html
 
-    // For linux OS console (CTRL+ALT+FN), who do not belong to any
-    // real standard.
-    // See: https://github.com/ArthurSonzogni/FTXUI/issues/685
-    {"\x1B[[A", "\x1BOP"},    // F1
-    {"\x1B[[B", "\x1BOQ"},    // F2
-    {"\x1B[[C", "\x1BOR"},    // F3
-    {"\x1B[[D", "\x1BOS"},    // F4
-    {"\x1B[[E", "\x1B[15~"},  // F5
-
-    // xterm-r5, xterm-r6, rxvt
-    {"\x1B[11~", "\x1BOP"},  // F1
-    {"\x1B[12~", "\x1BOQ"},  // F2
-    {"\x1B[13~", "\x1BOR"},  // F3
-    {"\x1B[14~", "\x1BOS"},  // F4
-
     // vt100
+    {"\x1BOl", "\x1B[19~"},  // F8
     {"\x1BOt", "\x1B[15~"},  // F5
     {"\x1BOu", "\x1B[17~"},  // F6
     {"\x1BOv", "\x1B[18~"},  // F7
-    {"\x1BOl", "\x1B[19~"},  // F8
     {"\x1BOw", "\x1B[20~"},  // F9
     {"\x1BOx", "\x1B[21~"},  // F10
 
+    // xterm-r5, xterm-r6, rxvt
+    {"\x1B[11~", "\x1BOP"},  // F1
+    {"\x1B[12~", "\x1BOQ"},  // F2
+    {"\x1B[13~", "\x1BOR"},  // F3
+    {"\x1B[14~", "\x1BOS"},  // F4
+
     // scoansi
     {"\x1B[M", "\x1BOP"},    // F1
     {"\x1B[N", "\x1BOQ"},    // F2
@@ -88,8 +90,105 @@ const std::map<std::string, std::string> g_uniformize = {
     {"\x1B[V", "\x1B[21~"},  // F10
     {"\x1B[W", "\x1B[23~"},  // F11
     {"\x1B[X", "\x1B[24~"},  // F12
+
+    // For linux OS console (CTRL+ALT+FN), who do not belong to any
+    // real standard.
+    // See: https://github.com/ArthurSonzogni/FTXUI/issues/685
+    {"\x1B[[A", "\x1BOP"},    // F1
+    {"\x1B[[B", "\x1BOQ"},    // F2
+    {"\x1B[[C", "\x1BOR"},    // F3
+    {"\x1B[[D", "\x1BOS"},    // F4
+    {"\x1B[[E", "\x1B[15~"},  // F5
 };
 
+constexpr bool IsSorted() {
+  for (size_t i = 1; i < std::size(g_uniformize); ++i) {
+    if (!(g_uniformize[i - 1].from < g_uniformize[i].from)) {
+      return false;
+    }
+  }
+  return true;
+}
+static_assert(IsSorted(), "g_uniformize must be sorted");
+
+std::string_view Uniformize(std::string_view input) {
+  const auto* it = std::lower_bound(
+      std::begin(g_uniformize), std::end(g_uniformize), input,
+      [](const Uniformized& a, std::string_view b) { return a.from < b; });
+  if (it != std::end(g_uniformize) && it->from == input) {
+    return it->to;
+  }
+  return input;
+}
+
+// The number of continuation bytes following |head|, the first byte of a
+// UTF-8 sequence. -1 when |head| can't start a sequence.
+//
+// Code point <-> UTF-8 conversion
+//
+// ┏━━━━━━━━┳━━━━━━━━┳━━━━━━━━┳━━━━━━━━┓
+// ┃Byte 1  ┃Byte 2  ┃Byte 3  ┃Byte 4  ┃
+// ┡━━━━━━━━╇━━━━━━━━╇━━━━━━━━╇━━━━━━━━┩
+// │0xxxxxxx│        │        │        │
+// ├────────┼────────┼────────┼────────┤
+// │110xxxxx│10xxxxxx│        │        │
+// ├────────┼────────┼────────┼────────┤
+// │1110xxxx│10xxxxxx│10xxxxxx│        │
+// ├────────┼────────┼────────┼────────┤
+// │11110xxx│10xxxxxx│10xxxxxx│10xxxxxx│
+// └────────┴────────┴────────┴────────┘
+int ContinuationBytes(unsigned char head) {
+  if (head < 0b1000'0000) {  // NOLINT
+    return 0;
+  }
+  if (head < 0b1100'0000) {  // NOLINT
+    return -1;
+  }
+  if (head < 0b1110'0000) {  // NOLINT
+    return 1;
+  }
+  if (head < 0b1111'0000) {  // NOLINT
+    return 2;
+  }
+  if (head < 0b1111'1000) {  // NOLINT
+    return 3;
+  }
+  return -1;
+}
+
+// The value bits of the first byte of a sequence.
+uint32_t LeadValue(unsigned char head, int continuation_bytes) {
+  return head & (0b0111'1111U >> continuation_bytes);  // NOLINT
+}
+
+// Some sequences are illegal if it exist a shorter representation of the same
+// codepoint.
+bool IsShortestUTF8(uint32_t value, int continuation_bytes) {
+  if (value <= 0b000'0000'0111'1111) {  // NOLINT
+    return continuation_bytes == 0;
+  }
+  if (value <= 0b000'0111'1111'1111) {  // NOLINT
+    return continuation_bytes == 1;
+  }
+  if (value <= 0b1111'1111'1111'1111) {  // NOLINT
+    return continuation_bytes == 2;
+  }
+  if (value <= 0b1'0000'1111'1111'1111'1111) {  // NOLINT
+    return continuation_bytes == 3;
+  }
+  return false;
+}
+
+// Bracketed paste: the terminal surrounds the text pasted by these markers.
+constexpr std::string_view g_paste_begin = "\x1B[200~";
+constexpr std::string_view g_paste_end = "\x1B[201~";
+
+bool IsContinuation(unsigned char c) {
+  return (c & 0b1100'0000) == 0b1000'0000;  // NOLINT
+}
+
+}  // namespace
+
 TerminalInputParser::TerminalInputParser(Sender<Task> out)
     : out_(std::move(out)) {}
 
@@ -100,28 +199,113 @@ void TerminalInputParser::Timeout(int time) {
     return;
   }
   timeout_ = 0;
-  if (!pending_.empty()) {
+  // The end of a paste is always sent. It may only be slow to arrive.
+  if (!pending_.empty() && state_ != State::Paste) {
     Send(SPECIAL);
   }
 }
 
+bool TerminalInputParser::HasPending() const {
+  return !pending_.empty();
+}
+
 void TerminalInputParser::Add(char c) {
-  pending_ += c;
+  Add(std::string_view(&c, 1));
+}
+
+void TerminalInputParser::Add(std::string_view input) {
   timeout_ = 0;
-  position_ = -1;
-  Send(Parse());
+  size_t i = 0;
+  while (i < input.size()) {
+    if (state_ == State::Ground) {
+      i = AddCharacters(input, i);
+      if (i == input.size()) {
+        return;
+      }
+    }
+
+    if (state_ == State::Paste) {
+      i = AddPaste(input, i);
+      continue;
+    }
+
+    // Skip to the string terminator of a DCS or OSC sequence.
+    if (state_ == State::DCS || state_ == State::OSC) {
+      const size_t end = std::min(input.find('\x1B', i), input.size());
+      pending_.append(input.data() + i, end - i);
+      i = end;
+      if (i == input.size()) {
+        return;
+      }
+    }
+
+    const auto c = static_cast<unsigned char>(input[i++]);
+    pending_ += static_cast<char>(c);
+    Send(Parse(c));
+  }
 }
 
-unsigned char TerminalInputParser::Current() {
-  return pending_[position_];
+// Fast path: send the complete and valid characters starting at |input[i]|
+// directly, without going through |pending_|. Returns where it stopped: at a
+// control character, an escape sequence, or a character to be parsed byte per
+// byte.
+size_t TerminalInputParser::AddCharacters(std::string_view input, size_t i) {
+  while (i < input.size()) {
+    const auto head = static_cast<unsigned char>(input[i]);
+    if (head >= ' ' && head < 127) {  // NOLINT
+      out_->Send(Event::Character(static_cast<char>(head)));
+      ++i;
+      continue;
+    }
+
+    const int continuation_bytes = ContinuationBytes(head);
+    if (continuation_bytes <= 0 ||
+        i + size_t(continuation_bytes) >= input.size()) {
+      return i;
+    }
+    uint32_t value = LeadValue(head, continuation_bytes);
+    for (int k = 1; k <= continuation_bytes; ++k) {
+      const auto c = static_cast<unsigned char>(input[i + size_t(k)]);
+      if (!IsContinuation(c)) {
+        return i;
+      }
+      value = (value << 6) | (c & 0b0011'1111);  // NOLINT
+    }
+    if (!IsShortestUTF8(value, continuation_bytes)) {
+      return i;
+    }
+    out_->Send(
+        Event::Character(std::string(input.substr(i, continuation_bytes + 1))));
+    i += size_t(continuation_bytes) + 1;
+  }
+  return i;
 }
 
-bool TerminalInputParser::Eat() {
-  position_++;
-  return position_ < static_cast<int>(pending_.size());
+// Append the pasted text starting at |input[i]|, up to the end marker, which
+// may be split across several calls. Returns where the paste ended.
+size_t TerminalInputParser::AddPaste(std::string_view input, size_t i) {
+  const size_t searched = std::max(
+      g_paste_begin.size(), pending_.size() - (g_paste_end.size() - 1));
+  pending_.append(input.data() + i, input.size() - i);
+  const size_t end = pending_.find(g_paste_end, searched);
+  if (end == std::string::npos) {
+    return input.size();
+  }
+
+  // The bytes after the paste are parsed again.
+  const size_t paste_size = end + g_paste_end.size();
+  const size_t after = pending_.size() - paste_size;
+  pending_.resize(paste_size);
+  Send(PASTE);
+  return input.size() - after;
 }
 
 void TerminalInputParser::Send(TerminalInputParser::Output output) {
+  if (output.type != UNCOMPLETED) {
+    // The sequence is complete, or dropped.
+    state_ = State::Ground;
+  }
+
   switch (output.type) {
     case UNCOMPLETED:
       return;
@@ -136,9 +320,9 @@ void TerminalInputParser::Send(TerminalInputParser::Output output) {
       return;
 
     case SPECIAL: {
-      auto it = g_uniformize.find(pending_);
-      if (it != g_uniformize.end()) {
-        pending_ = it->second;
+      const std::string_view uniformized = Uniformize(pending_);
+      if (uniformized.data() != pending_.data()) {
+        pending_ = uniformized;
       }
       out_->Send(Event::Special(std::move(pending_)));
       pending_.clear();
@@ -161,120 +345,104 @@ void TerminalInputParser::Send(TerminalInputParser::Output output) {
       out_->Send(Event::CursorShape(std::move(pending_), output.cursor_shape));
       pending_.clear();
       return;
+
+    case PASTE: {
+      const std::string_view text(pending_);
+      out_->Send(Event::Paste(text.substr(
+          g_paste_begin.size(),
+          text.size() - g_paste_begin.size() - g_paste_end.size())));
+      pending_.clear();
+      pending_.shrink_to_fit();
+    }
+      return;
   }
   // NOT_REACHED().
 }
 
-TerminalInputParser::Output TerminalInputParser::Parse() {
-  if (!Eat()) {
-    return UNCOMPLETED;
+// Parse |c|, the last byte of |pending_|.
+TerminalInputParser::Output TerminalInputParser::Parse(unsigned char c) {
+  switch (state_) {
+    case State::Ground:
+      return ParseGround(c);
+    case State::UTF8:
+      return ParseUTF8(c);
+    case State::ESC:
+      return ParseESC(c);
+    case State::ESCIntermediate:
+      return SPECIAL;
+    case State::CSI:
+      return ParseCSI(c);
+    case State::DCS:
+    case State::DCSEscape:
+      return ParseDCS(c);
+    case State::OSC:
+    case State::OSCEscape:
+      return ParseOSC(c);
+    case State::Paste:
+      return UNCOMPLETED;  // Handled by AddPaste().
   }
+  return DROP;  // NOT_REACHED().
+}
 
-  if (Current() == '\x1B') {
-    return ParseESC();
+TerminalInputParser::Output TerminalInputParser::ParseGround(unsigned char c) {
+  if (c == '\x1B') {
+    state_ = State::ESC;
+    return UNCOMPLETED;
   }
 
-  if (Current() < 32) {  // C0 NOLINT
+  if (c < 32) {  // C0 NOLINT
     return SPECIAL;
   }
 
-  if (Current() == 127) {  // Delete // NOLINT
+  if (c == 127) {  // Delete // NOLINT
     return SPECIAL;
   }
 
-  return ParseUTF8();
-}
-
-// Code point <-> UTF-8 conversion
-//
-// ┏━━━━━━━━┳━━━━━━━━┳━━━━━━━━┳━━━━━━━━┓
-// ┃Byte 1  ┃Byte 2  ┃Byte 3  ┃Byte 4  ┃
-// ┡━━━━━━━━╇━━━━━━━━╇━━━━━━━━╇━━━━━━━━┩
-// │0xxxxxxx│        │        │        │
-// ├────────┼────────┼────────┼────────┤
-// │110xxxxx│10xxxxxx│        │        │
-// ├────────┼────────┼────────┼────────┤
-// │1110xxxx│10xxxxxx│10xxxxxx│        │
-// ├────────┼────────┼────────┼────────┤
-// │11110xxx│10xxxxxx│10xxxxxx│10xxxxxx│
-// └────────┴────────┴────────┴────────┘
-//
-// Then some sequences are illegal if it exist a shorter representation of the
-// same codepoint.
-TerminalInputParser::Output TerminalInputParser::ParseUTF8() {
-  auto head = Current();
-  unsigned char selector = 0b1000'0000;  // NOLINT
-
-  // The non code-point part of the first byte.
-  unsigned char mask = selector;
-
-  // Find the first zero in the first byte.
-  unsigned int first_zero = 8;            // NOLINT
-  for (unsigned int i = 0; i < 8; ++i) {  // NOLINT
-    mask |= selector;
-    if (!(head & selector)) {
-      first_zero = i;
-      break;
-    }
-    selector >>= 1U;
-  }
-
-  // Accumulate the value of the first byte.
-  auto value = uint32_t(head & ~mask);  // NOLINT
-
-  // Invalid UTF8, with more than 5 bytes.
-  const unsigned int max_utf8_bytes = 5;
-  if (first_zero == 1 || first_zero >= max_utf8_bytes) {
+  const int continuation_bytes = ContinuationBytes(c);
+  if (continuation_bytes < 0) {
     return DROP;
   }
-
-  // Multi byte UTF-8.
-  for (unsigned int i = 2; i <= first_zero; ++i) {
-    if (!Eat()) {
-      return UNCOMPLETED;
-    }
-
-    // Invalid continuation byte.
-    head = Current();
-    if ((head & 0b1100'0000) != 0b1000'0000) {  // NOLINT
-      return DROP;
-    }
-    value <<= 6;                  // NOLINT
-    value += head & 0b0011'1111;  // NOLINT
+  if (continuation_bytes == 0) {
+    return CHARACTER;
   }
+  state_ = State::UTF8;
+  utf8_value_ = LeadValue(c, continuation_bytes);
+  utf8_remaining_ = continuation_bytes;
+  return UNCOMPLETED;
+}
 
-  // Check for overlong UTF8 encoding.
-  int extra_byte = 0;
-  if (value <= 0b000'0000'0111'1111) {                 // NOLINT
-    extra_byte = 0;                                    // NOLINT
-  } else if (value <= 0b000'0111'1111'1111) {          // NOLINT
-    extra_byte = 1;                                    // NOLINT
-  } else if (value <= 0b1111'1111'1111'1111) {         // NOLINT
-    extra_byte = 2;                                    // NOLINT
-  } else if (value <= 0b1'0000'1111'1111'1111'1111) {  // NOLINT
-    extra_byte = 3;                                    // NOLINT
-  } else {                                             // NOLINT
+TerminalInputParser::Output TerminalInputParser::ParseUTF8(unsigned char c) {
+  // Invalid continuation byte.
+  if (!IsContinuation(c)) {
     return DROP;
   }
+  utf8_value_ <<= 6;                // NOLINT
+  utf8_value_ += c & 0b0011'1111;  // NOLINT
+  if (--utf8_remaining_ > 0) {
+    return UNCOMPLETED;
+  }
 
-  if (extra_byte != position_) {
+  // Check for overlong UTF8 encoding.
+  const int continuation_bytes = static_cast<int>(pending_.size()) - 1;
+  if (!IsShortestUTF8(utf8_value_, continuation_bytes)) {
     return DROP;
   }
-
   return CHARACTER;
 }
 
-TerminalInputParser::Output TerminalInputParser::ParseESC() {
-  if (!Eat()) {
-    return UNCOMPLETED;
-  }
-  switch (Current()) {
+TerminalInputParser::Output TerminalInputParser::ParseESC(unsigned char c) {
+  switch (c) {
     case 'P':
-      return ParseDCS();
+      state_ = State::DCS;
+      return UNCOMPLETED;
     case '[':
-      return ParseCSI();
+      state_ = State::CSI;
+      csi_argument_ = 0;
+      csi_arguments_.clear();
+      return UNCOMPLETED;
     case ']':
-      return ParseOSC();
+      state_ = State::OSC;
+      return UNCOMPLETED;
 
     // Expecting 2 characters.
     case ' ':
@@ -285,12 +453,10 @@ TerminalInputParser::Output TerminalInputParser::ParseESC() {
     case '*':
     case '+':
     case 'O':
-    case 'N': {
-      if (!Eat()) {
-        return UNCOMPLETED;
-      }
-      return SPECIAL;
-    }
+    case 'N':
+      state_ = State::ESCIntermediate;
+      return UNCOMPLETED;
+
     // Expecting 1 character:
     default:
       return SPECIAL;
@@ -298,123 +464,110 @@ TerminalInputParser::Output TerminalInputParser::ParseESC() {
 }
 
 // ESC P ... ESC BACKSLASH
-TerminalInputParser::Output TerminalInputParser::ParseDCS() {
+TerminalInputParser::Output TerminalInputParser::ParseDCS(unsigned char c) {
   // Parse until the string terminator ST.
-  while (true) {
-    if (!Eat()) {
-      return UNCOMPLETED;
-    }
-
-    if (Current() != '\x1B') {
-      continue;
-    }
-
-    if (!Eat()) {
-      return UNCOMPLETED;
-    }
-
-    if (Current() != '\\') {
-      continue;
+  if (state_ == State::DCS) {
+    if (c == '\x1B') {
+      state_ = State::DCSEscape;
     }
+    return UNCOMPLETED;
+  }
 
-    if (pending_.size() == 10 &&  //
-        pending_[2] == '1' &&     //
-        pending_[3] == '$' &&     //
-        pending_[4] == 'r' &&     //
-        true) {
-      Output output(CURSOR_SHAPE);
-      output.cursor_shape = pending_[5] - '0';
-      return output;
-    }
+  if (c != '\\') {
+    state_ = State::DCS;
+    return UNCOMPLETED;
+  }
 
-    return SPECIAL;
+  if (pending_.size() == 10 &&  //
+      pending_[2] == '1' &&     //
+      pending_[3] == '$' &&     //
+      pending_[4] == 'r' &&     //
+      true) {
+    Output output(CURSOR_SHAPE);
+    output.cursor_shape = pending_[5] - '0';
+    return output;
   }
-}
 
-TerminalInputParser::Output TerminalInputParser::ParseCSI() {
-  bool altered = false;
-  int argument = 0;
-  std::vector<int> arguments;
-  while (true) {
-    if (!Eat()) {
-      return UNCOMPLETED;
-    }
+  return SPECIAL;
+}
 
-    if (Current() == '<') {
-      altered = true;
-      continue;
-    }
+TerminalInputParser::Output TerminalInputParser::ParseCSI(unsigned char c) {
+  if (c == '<') {
+    return UNCOMPLETED;
+  }
 
-    if (Current() >= '0' && Current() <= '9') {
-      argument *= 10;  // NOLINT
-      argument += Current() - '0';
-      continue;
-    }
+  if (c >= '0' && c <= '9') {
+    csi_argument_ *= 10;  // NOLINT
+    csi_argument_ += c - '0';
+    return UNCOMPLETED;
+  }
 
-    if (Current() == ';') {
-      arguments.push_back(argument);
-      argument = 0;
-      continue;
-    }
+  if (c == ';') {
+    csi_arguments_.push_back(csi_argument_);
+    csi_argument_ = 0;
+    return UNCOMPLETED;
+  }
 
-    // CSI is terminated by a character in the range 0x40–0x7E
-    // (ASCII @A–Z[\]^_`a–z{|}~),
-    if (Current() >= '@' && Current() <= '~' &&
-        // Note: I don't remember why we exclude '<'
-        Current() != '<' &&
-        // To handle F1-F4, we exclude '['.
-        Current() != '[') {
-      arguments.push_back(argument);
-      argument = 0;  // NOLINT
-
-      switch (Current()) {
-        case 'M':
-          return ParseMouse(altered, true, std::move(arguments));
-        case 'm':
-          return ParseMouse(altered, false, std::move(arguments));
-        case 'R':
-          return ParseCursorPosition(std::move(arguments));
-        default:
-          return SPECIAL;
-      }
+  // CSI is terminated by a character in the range 0x40–0x7E
+  // (ASCII @A–Z[\]^_`a–z{|}~),
+  if (c >= '@' && c <= '~' &&
+      // Note: I don't remember why we exclude '<'
+      c != '<' &&
+      // To handle F1-F4, we exclude '['.
+      c != '[') {
+    csi_arguments_.push_back(csi_argument_);
+    csi_argument_ = 0;  // NOLINT
+
+    switch (c) {
+      case 'M':
+        return ParseMouse(true);
+      case 'm':
+        return ParseMouse(false);
+      case 'R':
+        return ParseCursorPosition();
+      case '~':
+        if (pending_ == g_paste_begin) {
+          state_ = State::Paste;
+          return UNCOMPLETED;
+        }
+        return SPECIAL;
+      default:
+        return SPECIAL;
     }
+  }
 
-    // Invalid ESC in CSI.
-    if (Current() == '\x1B') {
-      return SPECIAL;
-    }
+  // Invalid ESC in CSI.
+  if (c == '\x1B') {
+    return SPECIAL;
   }
+
+  return UNCOMPLETED;
 }
 
-TerminalInputParser::Output TerminalInputParser::ParseOSC() {
+// ESC ] ... ESC BACKSLASH
+TerminalInputParser::Output TerminalInputParser::ParseOSC(unsigned char c) {
   // Parse until the string terminator ST.
-  while (true) {
-    if (!Eat()) {
-      return UNCOMPLETED;
+  if (state_ == State::OSC) {
+    if (c == '\x1B') {
+      state_ = State::OSCEscape;
     }
-    if (Current() != '\x1B') {
-      continue;
-    }
-    if (!Eat()) {
-      return UNCOMPLETED;
-    }
-    if (Current() != '\\') {
-      continue;
-    }
-    return SPECIAL;
+    return UNCOMPLETED;
+  }
+
+  if (c != '\\') {
+    state_ = State::OSC;
+    return UNCOMPLETED;
   }
+  return SPECIAL;
 }
 
 TerminalInputParser::Output TerminalInputParser::ParseMouse(  // NOLINT
-    bool altered,
-    bool pressed,
-    std::vector<int> arguments) {
+    bool pressed) {
+  const std::vector<int>& arguments = csi_arguments_;
   if (arguments.size() != 3) {
     return SPECIAL;
   }
 
-  (void)altered;
-
   Output output(MOUSE);
   output.mouse.motion = Mouse::Motion(pressed);  // NOLINT
 
@@ -450,8 +603,8 @@ TerminalInputParser::Output TerminalInputParser::ParseMouse(  // NOLINT
 }
 
 // NOLINTNEXTLINE
-TerminalInputParser::Output TerminalInputParser::ParseCursorPosition(
-    std::vector<int> arguments) {
+TerminalInputParser::Output TerminalInputParser::ParseCursorPosition() {
+  const std::vector<int>& arguments = csi_arguments_;
   if (arguments.size() != 2) {
     return SPECIAL;
   }
@@ -4,8 +4,11 @@
 #ifndef FTXUI_COMPONENT_TERMINAL_INPUT_PARSER
 #define FTXUI_COMPONENT_TERMINAL_INPUT_PARSER
 
-#include <string>  // for string
-#include <vector>  // for vector
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint32_t
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
 
 #include "ftxui/component/mouse.hpp"     // for Mouse
 #include "ftxui/component/receiver.hpp"  // for Sender
@@ -15,16 +18,20 @@ namespace ftxui {
 struct Event;
 
 // Parse a sequence of |char| accross |time|. Produces |Event|.
+//
+// The parser is a state machine resumed by every byte: a sequence split across
+// several calls to Add() is never parsed again from its start.
 class TerminalInputParser {
  public:
   explicit TerminalInputParser(Sender<Task> out);
   void Timeout(int time);
   void Add(char c);
+  void Add(std::string_view input);
 
- private:
-  unsigned char Current();
-  bool Eat();
+  // Whether an uncompleted sequence is waiting for more input, or a timeout.
+  bool HasPending() const;
 
+ private:
   enum Type {
     UNCOMPLETED,
     DROP,
@@ -33,6 +40,21 @@ class TerminalInputParser {
     CURSOR_POSITION,
     CURSOR_SHAPE,
     SPECIAL,
+    PASTE,
+  };
+
+  // Where the bytes of |pending_| left the parser.
+  enum class State {
+    Ground,
+    UTF8,             // Expecting continuation bytes.
+    ESC,              // ESC
+    ESCIntermediate,  // ESC, and a byte expecting one more.
+    CSI,              // ESC [
+    DCS,              // ESC P
+    DCSEscape,        // ESC P ... ESC
+    OSC,              // ESC ]
+    OSCEscape,        // ESC ] ... ESC
+    Paste,            // ESC [ 200 ~ ...
   };
 
   struct CursorPosition {
@@ -52,20 +74,30 @@ class TerminalInputParser {
         : type(t) {}
   };
 
+  size_t AddCharacters(std::string_view input, size_t i);
+  size_t AddPaste(std::string_view input, size_t i);
   void Send(Output output);
-  Output Parse();
-  Output ParseUTF8();
-  Output ParseESC();
-  Output ParseDCS();
-  Output ParseCSI();
-  Output ParseOSC();
-  Output ParseMouse(bool altered, bool pressed, std::vector<int> arguments);
-  Output ParseCursorPosition(std::vector<int> arguments);
+  Output Parse(unsigned char c);
+  Output ParseGround(unsigned char c);
+  Output ParseUTF8(unsigned char c);
+  Output ParseESC(unsigned char c);
+  Output ParseDCS(unsigned char c);
+  Output ParseCSI(unsigned char c);
+  Output ParseOSC(unsigned char c);
+  Output ParseMouse(bool pressed);
+  Output ParseCursorPosition();
 
   Sender<Task> out_;
-  int position_ = -1;
   int timeout_ = 0;
   std::string pending_;
+
+  State state_ = State::Ground;
+  // UTF8:
+  uint32_t utf8_value_ = 0;
+  int utf8_remaining_ = 0;
+  // CSI:
+  int csi_argument_ = 0;
+  std::vector<int> csi_arguments_;
 };
 
 }  // namespace ftxui
@@ -5,6 +5,9 @@
 #include <ftxui/component/task.hpp>   // for Task
 #include <initializer_list>           // for initializer_list
 #include <memory>                     // for allocator, unique_ptr
+#include <string>                     // for string
+#include <string_view>                // for string_view
+#include <vector>                     // for vector
 
 #include "ftxui/component/event.hpp"  // for Event, Event::Return, Event::ArrowDown, Event::ArrowLeft, Event::ArrowRight, Event::ArrowUp, Event::Backspace, Event::End, Event::Home, Event::Custom, Event::Delete, Event::F1, Event::F10, Event::F11, Event::F12, Event::F2, Event::F3, Event::F4, Event::F5, Event::F6, Event::F7, Event::F8, Event::F9, Event::PageDown, Event::PageUp, Event::Tab, Event::TabReverse, Event::Escape
 #include "ftxui/component/receiver.hpp"  // for MakeReceiver, ReceiverImpl
@@ -510,5 +513,114 @@ TEST(Event, DeviceControlString) {
   EXPECT_FALSE(event_receiver->Receive(&received));
 }
 
+// Parse |input|, split into chunks of |chunk| bytes.
+std::vector<Event> Parse(std::string_view input, size_t chunk) {
+  auto event_receiver = MakeReceiver<Task>();
+  {
+    auto parser = TerminalInputParser(event_receiver->MakeSender());
+    for (size_t i = 0; i < input.size(); i += chunk) {
+      parser.Add(input.substr(i, chunk));
+    }
+    parser.Timeout(50);
+  }
+  std::vector<Event> events;
+  Task received;
+  while (event_receiver->Receive(&received)) {
+    events.push_back(std::get<Event>(received));
+  }
+  return events;
+}
+
+TEST(Event, Bulk) {
+  // Note: The invalid UTF-8 sequences are dropped, with the byte interrupting
+  // them.
+  const std::string input =
+      "hello \xC3\xA9t\xC3\xA9 \xE2\x9C\x93 \xF0\x9F\x98\x80"  // UTF-8
+      "\xC0\x80\xE1\x80z"                                  // Invalid
+      "\r\x08\x1B[A\x1BOA\x1B[[A\x1B[11~"                  // Keys
+      "\x1B[0;12;42M\x1B[12;42R"                           // Reports
+      "\x1BP1$r1 q\x1B\\"                                  // DCS
+      "\x1B]52;c;aGVsbG8=\x1B\\"                           // OSC
+      "\x1B\x1B\x1B[<0;1;2m bye\x1B";
+
+  // Parsed byte per byte.
+  const std::vector<Event> expected = Parse(input, 1);
+  ASSERT_EQ(expected.size(), 30u);
+  EXPECT_EQ(expected[0], Event::Character('h'));
+  EXPECT_EQ(expected[6], Event::Character("\xC3\xA9"));
+  EXPECT_EQ(expected[12], Event::Character("\xF0\x9F\x98\x80"));
+  EXPECT_EQ(expected[13], Event::Return);
+  EXPECT_EQ(expected[14], Event::Backspace);
+  EXPECT_EQ(expected[15], Event::ArrowUp);
+  EXPECT_EQ(expected[16], Event::ArrowUp);
+  EXPECT_EQ(expected[17], Event::F1);
+  EXPECT_EQ(expected[18], Event::F1);
+  EXPECT_TRUE(expected[19].is_mouse());
+  EXPECT_TRUE(expected[20].is_cursor_position());
+  EXPECT_TRUE(expected[21].is_cursor_shape());
+  EXPECT_EQ(expected[22], Event::Special("\x1B]52;c;aGVsbG8=\x1B\\"));
+  EXPECT_EQ(expected[23], Event::Special("\x1B\x1B"));
+  EXPECT_TRUE(expected[24].is_mouse());
+  EXPECT_EQ(expected[29], Event::Escape);
+
+  // The same events, however the input is split.
+  for (size_t chunk : {2, 3, 5, 7, 64}) {
+    EXPECT_EQ(Parse(input, chunk), expected) << "chunk: " << chunk;
+  }
+}
+
+TEST(Event, BulkLongSequence) {
+  std::string payload(100'000, 'a');
+  const std::string input = "\x1B]52;c;" + payload + "\x1B\\x";
+  const std::vector<Event> events = Parse(input, 4096);
+  ASSERT_EQ(events.size(), 2u);
+  EXPECT_EQ(events[0].input().size(), input.size() - 1);
+  EXPECT_EQ(events[1], Event::Character('x'));
+}
+
+TEST(Event, BracketedPaste) {
+  const std::string input =
+      "a\x1B[200~hello\r\x1B[A w\xC3\xB6rld\x1B[201~b\x1B[201~";
+  for (size_t chunk : {1, 2, 3, 7, 64}) {
+    const std::vector<Event> events = Parse(input, chunk);
+    ASSERT_EQ(events.size(), 4u) << "chunk: " << chunk;
+    EXPECT_EQ(events[0], Event::Character('a'));
+    EXPECT_TRUE(events[1].is_paste());
+    EXPECT_EQ(events[1].paste(), "hello\r\x1B[A w\xC3\xB6rld");
+    EXPECT_EQ(events[1], Event::Paste("hello\r\x1B[A w\xC3\xB6rld"));
+    EXPECT_EQ(events[2], Event::Character('b'));
+    // An end marker outside of a paste.
+    EXPECT_EQ(events[3], Event::Special("\x1B[201~"));
+  }
+}
+
+TEST(Event, BracketedPasteLarge) {
+  std::string text;
+  while (text.size() < 1'000'000) {
+    text += "The quick brown fox jumps over the lazy dog.\r";
+  }
+  const std::vector<Event> events =
+      Parse("\x1B[200~" + text + "\x1B[201~", 4096);
+  ASSERT_EQ(events.size(), 1u);
+  EXPECT_TRUE(events[0].is_paste());
+  EXPECT_EQ(events[0].paste(), text);
+}
+
+TEST(Event, BracketedPasteWaitsForTheEnd) {
+  auto event_receiver = MakeReceiver<Task>();
+  {
+    auto parser = TerminalInputParser(event_receiver->MakeSender());
+    parser.Add("\x1B[200~abc");
+    parser.Timeout(1000);
+    EXPECT_TRUE(parser.HasPending());
+    parser.Add("\x1B[201~");
+    EXPECT_FALSE(parser.HasPending());
+  }
+  Task received;
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_EQ(std::get<Event>(received).paste(), "abc");
+  EXPECT_FALSE(event_receiver->Receive(&received));
+}
+
 }  // namespace ftxui
    // NOLINTEND
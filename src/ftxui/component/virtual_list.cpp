@@ -0,0 +1,173 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <algorithm>   // for max
+#include <functional>  // for function
+#include <map>         // for map
+#include <string>      // for to_string
+#include <utility>     // for move
+
+#include "ftxui/component/component.hpp"          // for Make, VirtualList
+#include "ftxui/component/component_base.hpp"     // for ComponentBase
+#include "ftxui/component/component_options.hpp"  // for VirtualListOption
+#include "ftxui/component/event.hpp"  // for Event, Event::ArrowDown, Event::ArrowUp, Event::End, Event::Home, Event::PageDown, Event::PageUp
+#include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::WheelDown, Mouse::WheelUp, Mouse::Left, Mouse::Pressed
+#include "ftxui/dom/elements.hpp"  // for operator|, reflect, Element, text, inverted, virtualList
+#include "ftxui/screen/box.hpp"   // for Box
+#include "ftxui/screen/util.hpp"  // for clamp
+#include "ftxui/util/ref.hpp"     // for Ref, ConstRef
+
+namespace ftxui {
+
+namespace {
+
+Element DefaultRow(int index, bool focused) {
+  auto element = text(std::to_string(index));
+  if (focused) {
+    element |= inverted;
+  }
+  return element;
+}
+
+/// @brief A list of rows, where one can be selected. Only the visible rows
+/// are built.
+/// @ingroup component
+class VirtualListBase : public ComponentBase, public VirtualListOption {
+ public:
+  explicit VirtualListBase(VirtualListOption option)
+      : VirtualListOption(std::move(option)) {
+    row_height = std::max(row_height, 1);
+    if (!row) {
+      row = DefaultRow;
+    }
+  }
+
+ private:
+  Element OnRender() override {
+    Clamp();
+    const bool is_focused = Focused();
+    row_boxes_.clear();
+    auto build = [this, is_focused](int i) {
+      return row(i, is_focused && selected() == i) | reflect(row_boxes_[i]);
+    };
+    return virtualList(size(), row_height, build, selected()) | reflect(box_);
+  }
+
+  bool OnEvent(Event event) override {
+    Clamp();
+    if (!CaptureMouse(event)) {
+      return false;
+    }
+
+    if (event.is_mouse()) {
+      return OnMouseEvent(event);
+    }
+
+    if (!Focused()) {
+      return false;
+    }
+
+    const int old_selected = selected();
+    const int page = std::max(1, (box_.y_max - box_.y_min) / row_height);
+    if (event == Event::ArrowUp || event == Event::Character('k')) {
+      selected()--;
+    }
+    if (event == Event::ArrowDown || event == Event::Character('j')) {
+      selected()++;
+    }
+    if (event == Event::PageUp) {
+      selected() -= page;
+    }
+    if (event == Event::PageDown) {
+      selected() += page;
+    }
+    if (event == Event::Home) {
+      selected() = 0;
+    }
+    if (event == Event::End) {
+      selected() = size() - 1;
+    }
+    return Select(old_selected);
+  }
+
+  bool OnMouseEvent(Event event) {
+    if (!box_.Contain(event.mouse().x, event.mouse().y)) {
+      return false;
+    }
+
+    const int old_selected = selected();
+    if (event.mouse().button == Mouse::WheelUp) {
+      selected()--;
+      Select(old_selected);
+      return true;
+    }
+    if (event.mouse().button == Mouse::WheelDown) {
+      selected()++;
+      Select(old_selected);
+      return true;
+    }
+
+    if (event.mouse().button != Mouse::Left ||
+        event.mouse().motion != Mouse::Pressed) {
+      return false;
+    }
+
+    for (const auto& [index, box] : row_boxes_) {
+      if (box.Contain(event.mouse().x, event.mouse().y)) {
+        TakeFocus();
+        selected() = index;
+        Select(old_selected);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Clamp the selection, and notify if it moved from |old_selected|.
+  bool Select(int old_selected) {
+    Clamp();
+    if (selected() == old_selected) {
+      return false;
+    }
+    on_change();
+    return true;
+  }
+
+  void Clamp() { selected() = util::clamp(selected(), 0, size() - 1); }
+
+  bool Focusable() const final { return size() > 0; }
+  int size() const { return std::max(VirtualListOption::size(), 0); }
+
+  // The boxes of the rows displayed on the last frame, by index.
+  std::map<int, Box> row_boxes_;
+  Box box_;
+};
+
+}  // namespace
+
+/// @brief A list of rows, where one can be selected. Unlike `Menu` or
+/// `Radiobox`, only the rows visible on screen are built, so it can hold
+/// millions of them.
+/// @param option The parameters
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::TerminalOutput();
+/// int selected = 0;
+/// auto list = VirtualList({
+///   .size = 1'000'000,
+///   .selected = &selected,
+///   .row = [](int index, bool focused) {
+///     auto element = text("Line " + std::to_string(index));
+///     return focused ? element | inverted : element;
+///   },
+/// });
+/// screen.Loop(list | size(HEIGHT, LESS_THAN, 10));
+/// ```
+Component VirtualList(VirtualListOption option) {
+  return Make<VirtualListBase>(std::move(option));
+}
+
+}  // namespace ftxui
@@ -0,0 +1,103 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <ftxui/dom/elements.hpp>   // for text, Element
+#include <ftxui/dom/node.hpp>       // for Render
+#include <ftxui/screen/screen.hpp>  // for Screen
+#include <string>                   // for to_string, string
+
+#include "ftxui/component/component.hpp"       // for VirtualList
+#include "ftxui/component/component_base.hpp"  // for ComponentBase, Component
+#include "ftxui/component/component_options.hpp"  // for VirtualListOption
+#include "ftxui/component/event.hpp"  // for Event, Event::ArrowDown, Event::ArrowUp, Event::End, Event::Home, Event::PageDown, Event::PageUp
+#include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::Left, Mouse::Pressed
+#include "gtest/gtest.h"  // for AssertionResult, Message, TestPartResult, EXPECT_EQ, EXPECT_TRUE, Test, EXPECT_FALSE, TEST
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+Event MousePressed(int x, int y) {
+  Mouse mouse;
+  mouse.button = Mouse::Left;
+  mouse.motion = Mouse::Pressed;
+  mouse.shift = false;
+  mouse.meta = false;
+  mouse.control = false;
+  mouse.x = x;
+  mouse.y = y;
+  return Event::Mouse("", mouse);
+}
+}  // namespace
+
+TEST(VirtualListTest, Navigation) {
+  int selected = 0;
+  int changes = 0;
+  auto list = VirtualList({
+      .size = 1'000'000,
+      .selected = &selected,
+      .on_change = [&] { changes++; },
+  });
+
+  Screen screen(8, 10);
+  Render(screen, list->Render());
+
+  EXPECT_FALSE(list->OnEvent(Event::ArrowUp));
+  EXPECT_EQ(selected, 0);
+  EXPECT_TRUE(list->OnEvent(Event::ArrowDown));
+  EXPECT_EQ(selected, 1);
+  EXPECT_TRUE(list->OnEvent(Event::Character('j')));
+  EXPECT_EQ(selected, 2);
+  EXPECT_TRUE(list->OnEvent(Event::Character('k')));
+  EXPECT_EQ(selected, 1);
+  EXPECT_TRUE(list->OnEvent(Event::PageDown));
+  EXPECT_EQ(selected, 10);
+  EXPECT_TRUE(list->OnEvent(Event::PageUp));
+  EXPECT_EQ(selected, 1);
+  EXPECT_TRUE(list->OnEvent(Event::End));
+  EXPECT_EQ(selected, 999'999);
+  EXPECT_FALSE(list->OnEvent(Event::ArrowDown));
+  EXPECT_EQ(selected, 999'999);
+  EXPECT_TRUE(list->OnEvent(Event::Home));
+  EXPECT_EQ(selected, 0);
+  EXPECT_EQ(changes, 7);
+}
+
+TEST(VirtualListTest, RenderAroundSelected) {
+  int selected = 500;
+  auto list = VirtualList({
+      .size = 1'000'000,
+      .selected = &selected,
+      .row =
+          [](int index, bool focused) {
+            return text((focused ? ">" : " ") + std::to_string(index));
+          },
+  });
+
+  Screen screen(5, 3);
+  Render(screen, list->Render());
+  EXPECT_EQ(screen.ToString(),
+            " 499 \r\n"
+            ">500 \r\n"
+            " 501 ");
+}
+
+TEST(VirtualListTest, MouseClick) {
+  int selected = 0;
+  auto list = VirtualList({
+      .size = 100,
+      .selected = &selected,
+  });
+
+  Screen screen(5, 3);
+  Render(screen, list->Render());
+  EXPECT_TRUE(list->OnEvent(MousePressed(1, 2)));
+  EXPECT_EQ(selected, 2);
+
+  Render(screen, list->Render());
+  EXPECT_FALSE(list->OnEvent(MousePressed(1, 5)));
+  EXPECT_EQ(selected, 2);
+}
+
+}  // namespace ftxui
+// NOLINTEND
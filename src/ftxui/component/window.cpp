@@ -10,6 +10,7 @@
 #include <memory>
 #include <utility>
 #include "ftxui/dom/elements.hpp"  // for text, window, hbox, vbox, size, clear_under, reflect, emptyElement
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
 #include "ftxui/screen/color.hpp"        // for Color
 #include "ftxui/screen/screen.hpp"       // for Screen
@@ -102,7 +103,7 @@ Element DefaultRenderState(const WindowRenderState& state) {
 
   const Color color = Color::Red;
 
-  element = std::make_shared<ResizeDecorator>(  //
+  element = MakeNode<ResizeDecorator>(  //
       element,                                  //
       state.hover_left,                         //
       state.hover_right,                        //
@@ -2,12 +2,44 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include <benchmark/benchmark.h>
+#include <atomic>   // for atomic
+#include <cmath>    // for sin
+#include <cstdint>  // for uint32_t
+#include <cstdlib>  // for malloc, free
+#include <memory>   // for make_shared
+#include <new>      // for bad_alloc
+#include <vector>   // for vector
 
+#include "ftxui/dom/canvas.hpp"    // for Canvas
 #include "ftxui/dom/elements.hpp"  // for gauge, separator, operator|, text, Element, hbox, vbox, blink, border, inverted
+#include "ftxui/dom/frame_arena.hpp"  // for FrameArena
 #include "ftxui/dom/node.hpp"      // for Render
+#include "ftxui/dom/render_pool.hpp"  // for RenderPool
+#include "ftxui/dom/time_series.hpp"  // for TimeSeries
 #include "ftxui/screen/screen.hpp"  // for Screen
+#include "ftxui/screen/string.hpp"  // for string_width, Utf8ToGlyphs, GlyphCount
 
 // NOLINTBEGIN
+
+// Count the heap allocations, to measure how many are made per frame.
+static std::atomic<size_t> g_allocations{0};
+
+void* operator new(std::size_t size) {
+  g_allocations++;
+  if (void* ptr = std::malloc(size ? size : 1)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept {
+  std::free(ptr);
+}
+
 namespace ftxui {
 
 static void BencharkBasic(benchmark::State& state) {
@@ -48,7 +80,49 @@ static void BencharkText(benchmark::State& state) {
 }
 BENCHMARK(BencharkText)->DenseRange(0, 10, 1);
 
+// A 4KB line of log, made of ASCII (0), CJK (1), or mixed (2) characters.
+static std::string LogLine(int64_t kind) {
+  const char* pieces[] = {
+      "[info] request served in 12ms ",
+      "请求已在十二毫秒内完成处理 ",
+      "[info] 请求 served in 12ms ✓ ",
+  };
+  std::string out;
+  while (out.size() < 4096) {
+    out += pieces[kind];
+  }
+  return out;
+}
+
+static void BenchmarkStringWidth(benchmark::State& state) {
+  const std::string input = LogLine(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(string_width(input));
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BenchmarkStringWidth)->DenseRange(0, 2, 1);
+
+static void BenchmarkGlyphCount(benchmark::State& state) {
+  const std::string input = LogLine(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(GlyphCount(input));
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BenchmarkGlyphCount)->DenseRange(0, 2, 1);
+
+static void BenchmarkUtf8ToGlyphs(benchmark::State& state) {
+  const std::string input = LogLine(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Utf8ToGlyphs(input));
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BenchmarkUtf8ToGlyphs)->DenseRange(0, 2, 1);
+
 static void BenchmarkStyle(benchmark::State& state) {
+  size_t bytes = 0;
   while (state.KeepRunning()) {
     Elements elements;
     for (int i = 0; i < state.range(0); ++i) {
@@ -73,8 +147,9 @@ static void BenchmarkStyle(benchmark::State& state) {
     auto document = hbox(std::move(elements));
     Screen screen(state.range(1), state.range(1));
     Render(screen, document);
-    screen.ToString();
+    bytes = screen.ToString().size();
   }
+  state.counters["bytes_per_frame"] = static_cast<double>(bytes);
 }
 BENCHMARK(BenchmarkStyle)
     ->ArgsProduct({
@@ -82,5 +157,365 @@ BENCHMARK(BenchmarkStyle)
         benchmark::CreateDenseRange(10, 200, 20),  // Screen width.
     });
 
+// Fill a 300x80 screen with text, and modify |ratio| percent of its cells.
+static void PrepareDiffScreens(Screen& previous, Screen& screen, int ratio) {
+  const std::string line = "The quick brown fox jumps over the lazy dog. ";
+  for (int y = 0; y < previous.height(); ++y) {
+    for (int x = 0; x < previous.width(); ++x) {
+      previous.PixelAt(x, y).grapheme = line[(x + y) % line.size()];
+    }
+  }
+  screen = previous;
+
+  const int stride = 100 / ratio;
+  const int size = screen.width() * screen.height();
+  for (int i = 0; i < size; i += stride) {
+    Pixel& pixel = screen.PixelAt(i % screen.width(), i / screen.width());
+    pixel.grapheme = "#";
+    pixel.style.foreground_color = Color::Red;
+  }
+}
+
+static void BenchmarkToStringFull(benchmark::State& state) {
+  Screen previous(300, 80);
+  Screen screen(300, 80);
+  PrepareDiffScreens(previous, screen, state.range(0));
+  size_t bytes = 0;
+  for (auto _ : state) {
+    std::string output = screen.ToString();
+    bytes = output.size();
+    benchmark::DoNotOptimize(output);
+  }
+  state.counters["bytes_per_frame"] = bytes;
+}
+BENCHMARK(BenchmarkToStringFull)->Arg(1)->Arg(10)->Arg(100);
+
+static void BenchmarkToStringDiff(benchmark::State& state) {
+  Screen previous(300, 80);
+  Screen screen(300, 80);
+  PrepareDiffScreens(previous, screen, state.range(0));
+  size_t bytes = 0;
+  for (auto _ : state) {
+    std::string output = screen.ToStringDiff(previous);
+    bytes = output.size();
+    benchmark::DoNotOptimize(output);
+  }
+  state.counters["bytes_per_frame"] = bytes;
+}
+BENCHMARK(BenchmarkToStringDiff)->Arg(1)->Arg(10)->Arg(100);
+
+// Render a colorful document, exercising every style transition.
+static void PrepareStyledScreen(Screen& screen) {
+  Elements elements;
+  for (int i = 0; i < 10; ++i) {
+    elements.push_back(vbox({
+        text("Test") | bold,
+        text("Test") | dim,
+        text("Test") | inverted,
+        text("Test") | underlined,
+        text("Test") | color(Color::Red),
+        text("Test") | bgcolor(Color::Red),
+        text("Test") | color(Color::Palette256(87)),
+        text("Test") | color(Color::RGB(42, 87, 124)) |
+            bgcolor(Color::RGB(172, 94, 212)),
+    }));
+    elements.push_back(separator());
+  }
+  Render(screen, hbox(std::move(elements)));
+}
+
+static void BenchmarkToStringAllocations(benchmark::State& state) {
+  Screen screen(state.range(0), state.range(0));
+  PrepareStyledScreen(screen);
+  size_t allocations = 0;
+  for (auto _ : state) {
+    const size_t before = g_allocations;
+    std::string output = screen.ToString();
+    allocations = g_allocations - before;
+    benchmark::DoNotOptimize(output);
+  }
+  state.counters["allocations_per_frame"] = allocations;
+}
+BENCHMARK(BenchmarkToStringAllocations)->Arg(20)->Arg(80)->Arg(200);
+
+static void BenchmarkToStringReusedBuffer(benchmark::State& state) {
+  Screen screen(state.range(0), state.range(0));
+  PrepareStyledScreen(screen);
+  std::string output;
+  screen.ToString(output);  // Grow the buffer to the size of a frame.
+  size_t allocations = 0;
+  for (auto _ : state) {
+    const size_t before = g_allocations;
+    screen.ToString(output);
+    allocations = g_allocations - before;
+    benchmark::DoNotOptimize(output);
+  }
+  state.counters["allocations_per_frame"] = allocations;
+}
+BENCHMARK(BenchmarkToStringReusedBuffer)->Arg(20)->Arg(80)->Arg(200);
+
+// A status bar drawn at the bottom of a large, otherwise empty, terminal.
+// Clearing and printing only visit the rows drawn into.
+static void BenchmarkSparseFrame(benchmark::State& state) {
+  Screen screen(state.range(0), state.range(0) / 4);
+  auto document = vbox({
+      filler(),
+      hbox({text("status") | inverted, filler(), text("12:00")}) | bold,
+  });
+  std::string output;
+  for (auto _ : state) {
+    screen.Clear();
+    Render(screen, document);
+    screen.ToString(output);
+    benchmark::DoNotOptimize(output);
+  }
+}
+BENCHMARK(BenchmarkSparseFrame)->Arg(80)->Arg(320)->Arg(1280);
+
+// A screen covered by a grid of box drawing characters, every cell merging
+// with its neighbours.
+static void BenchmarkMergeGrid(benchmark::State& state) {
+  Screen screen(state.range(0), 50);
+  for (auto _ : state) {
+    for (int y = 0; y < screen.height(); ++y) {
+      for (int x = 0; x < screen.width(); ++x) {
+        Pixel& pixel = screen.PixelAt(x, y);
+        pixel.grapheme = (y % 4 == 0) ? "━" : (x % 4 == 0) ? "│" : "─";
+        pixel.style.automerge = true;
+      }
+    }
+    screen.ApplyShader();
+    benchmark::DoNotOptimize(screen.PixelAt(0, 0));
+  }
+  state.SetItemsProcessed(state.iterations() * screen.width() * screen.height());
+}
+BENCHMARK(BenchmarkMergeGrid)->Arg(200)->Arg(1000)->Arg(4000);
+
+// A dashboard of about 5000 elements, where a single gauge moves per frame.
+static Element DashboardRow(int i) {
+  return hbox({
+      text("metric " + std::to_string(i)) | bold,
+      separator(),
+      text("value") | color(Color::Green),
+      separator(),
+      gauge(0.5f) | flex,
+  });
+}
+
+// Rebuild every element on every frame.
+static void BenchmarkLayoutRebuilt(benchmark::State& state) {
+  Screen screen(200, 50);
+  int frame = 0;
+  for (auto _ : state) {
+    Elements rows;
+    for (int i = 0; i < 500; ++i) {
+      rows.push_back(DashboardRow(i));
+    }
+    rows.push_back(gauge(float(++frame % 100) / 100.f));
+    Render(screen, vbox(std::move(rows)));
+  }
+}
+BENCHMARK(BenchmarkLayoutRebuilt);
+
+// Keep the static rows between frames. Only the moving gauge and the root are
+// laid out again.
+static void BenchmarkLayoutMostlyStatic(benchmark::State& state) {
+  Screen screen(200, 50);
+  Elements static_rows;
+  for (int i = 0; i < 500; ++i) {
+    static_rows.push_back(DashboardRow(i));
+  }
+  int frame = 0;
+  for (auto _ : state) {
+    Elements rows = static_rows;
+    rows.push_back(gauge(float(++frame % 100) / 100.f));
+    Render(screen, vbox(std::move(rows)));
+  }
+}
+BENCHMARK(BenchmarkLayoutMostlyStatic);
+
+// Rebuild the dashboard on every frame, with (1) or without (0) a frame arena.
+static void BenchmarkFrameArena(benchmark::State& state) {
+  Screen screen(200, 50);
+  FrameArena arena;
+  size_t allocations = 0;
+  int frame = 0;
+  for (auto _ : state) {
+    arena.Reset();
+    FrameArena::Scope scope(state.range(0) ? &arena : nullptr);
+    const size_t before = g_allocations;
+    Elements rows;
+    for (int i = 0; i < 500; ++i) {
+      rows.push_back(DashboardRow(i));
+    }
+    rows.push_back(gauge(float(++frame % 100) / 100.f));
+    Render(screen, vbox(std::move(rows)));
+    allocations += g_allocations - before;
+  }
+  state.counters["allocations_per_frame"] =
+      double(allocations) / double(state.iterations());
+}
+BENCHMARK(BenchmarkFrameArena)->Arg(0)->Arg(1);
+
+static Element WavePanel(int index, int frame) {
+  if (index % 2) {
+    return graph([index, frame](int width, int height) {
+      std::vector<int> values(width);
+      for (int x = 0; x < width; ++x) {
+        const float phase = float(x + frame + index * 7) * 0.1f;
+        values[x] = int(float(height) * (0.5f + 0.4f * std::sin(phase)));
+      }
+      return values;
+    });
+  }
+  return canvas([index, frame](Canvas& c) {
+    for (int x = 0; x + 1 < c.width(); ++x) {
+      const auto y = [&](int x) {
+        const float phase = float(x + frame + index * 7) * 0.05f;
+        return int(float(c.height()) * (0.5f + 0.4f * std::sin(phase)));
+      };
+      c.DrawPointLine(x, y(x), x + 1, y(x + 1), Color::Green);
+    }
+    c.DrawPointCircle(c.width() / 2, c.height() / 2, c.height() / 3);
+  });
+}
+
+// A wall dashboard: a 400x120 screen split into panels drawing a canvas or a
+// graph, rendered with 1 to 16 threads.
+static void BenchmarkRenderThreads(benchmark::State& state) {
+  RenderPool pool(int(state.range(0)));
+  const RenderPool::Scope scope(&pool);
+  Screen screen(400, 120);
+  int frame = 0;
+  for (auto _ : state) {
+    ++frame;
+    Elements rows;
+    for (int y = 0; y < 4; ++y) {
+      Elements row;
+      for (int x = 0; x < 6; ++x) {
+        row.push_back(WavePanel(y * 6 + x, frame) | border | flex);
+      }
+      rows.push_back(hbox(std::move(row)) | flex);
+    }
+    screen.Clear();
+    Render(screen, vbox(std::move(rows)));
+  }
+}
+BENCHMARK(BenchmarkRenderThreads)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->UseRealTime();
+
+// A scatter plot of 10k to 1M points, drawn one dot at a time (0), or at once
+// with DrawPoints (1).
+static void BenchmarkCanvasPoints(benchmark::State& state) {
+  std::vector<Canvas::Point> points(state.range(0));
+  uint32_t seed = 1;
+  for (auto& point : points) {
+    seed = seed * 1664525u + 1013904223u;
+    point.x = int(seed >> 8) % 400;
+    point.y = int(seed >> 20) % 200;
+  }
+  for (auto _ : state) {
+    Canvas c(400, 200);
+    if (state.range(1)) {
+      c.DrawPoints(points.data(), points.size(), Color::Red);
+    } else {
+      for (const auto& point : points) {
+        c.DrawPoint(point.x, point.y, true, Color::Red);
+      }
+    }
+    benchmark::DoNotOptimize(c.PixelAt(0, 0));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkCanvasPoints)
+    ->ArgsProduct({{10'000, 100'000, 1'000'000}, {0, 1}});
+
+// A monitoring view of 100k samples, receiving 17 new ones per frame: graph()
+// resampling the whole history every frame (0), or timeSeries() (1).
+static void BenchmarkTimeSeries(benchmark::State& state) {
+  const size_t capacity = 100'000;
+  std::vector<float> history;
+  auto series = std::make_shared<TimeSeries>(capacity);
+  int sample = 0;
+  const auto push = [&] {
+    const float value = std::sin(float(sample++) * 0.01f);
+    series->Push(value);
+    history.push_back(value);
+    if (history.size() > capacity) {
+      history.erase(history.begin(), history.begin() + 1'000);
+    }
+  };
+  for (size_t i = 0; i < capacity; ++i) {
+    push();
+  }
+
+  Screen screen(200, 20);
+  for (auto _ : state) {
+    for (int i = 0; i < 17; ++i) {
+      push();
+    }
+    Element element;
+    if (state.range(0)) {
+      element = timeSeries(series);
+    } else {
+      element = graph([&](int width, int height) {
+        std::vector<int> values(width);
+        const size_t bucket = history.size() / size_t(width);
+        for (int x = 0; x < width; ++x) {
+          float sum = 0.f;
+          for (size_t j = 0; j < bucket; ++j) {
+            sum += history[size_t(x) * bucket + j];
+          }
+          values[x] = int((sum / float(bucket) + 1.f) * 0.5f * float(height));
+        }
+        return values;
+      });
+    }
+    screen.Clear();
+    Render(screen, element);
+  }
+}
+BENCHMARK(BenchmarkTimeSeries)->Arg(0)->Arg(1);
+
+static Element ListRow(int i) {
+  return hbox({
+      text("item " + std::to_string(i)) | bold,
+      text(" | "),
+      text("value") | color(Color::Green),
+  });
+}
+
+// Scroll through a list, built entirely then clipped by a frame.
+static void BenchmarkListFrame(benchmark::State& state) {
+  Screen screen(80, 50);
+  const int count = state.range(0);
+  int focused = 0;
+  for (auto _ : state) {
+    Elements rows;
+    rows.reserve(count);
+    for (int i = 0; i < count; ++i) {
+      auto row = ListRow(i);
+      rows.push_back(i == focused ? row | focus : row);
+    }
+    Render(screen, vbox(std::move(rows)) | yframe);
+    focused = (focused + 1) % count;
+  }
+}
+BENCHMARK(BenchmarkListFrame)->Arg(1'000)->Arg(10'000);
+
+// Scroll through a list, building only the visible rows.
+static void BenchmarkListVirtual(benchmark::State& state) {
+  Screen screen(80, 50);
+  const int count = state.range(0);
+  int focused = 0;
+  for (auto _ : state) {
+    Render(screen, virtualList(count, 1, ListRow, focused));
+    focused = (focused + 1) % count;
+  }
+}
+BENCHMARK(BenchmarkListVirtual)->Arg(1'000)->Arg(10'000)->Arg(1'000'000);
+
 }  // namespace ftxui
 // NOLINTEND
@@ -4,13 +4,14 @@
 #include <algorithm>               // for max
 #include <array>                   // for array
 #include <ftxui/screen/color.hpp>  // for Color
-#include <memory>    // for allocator, make_shared, __shared_ptr_access
+#include <memory>    // for allocator, __shared_ptr_access
 #include <optional>  // for optional, nullopt
 #include <string>    // for basic_string, string
 #include <string_view>  // for string_view
 #include <utility>      // for move
 
 #include "ftxui/dom/elements.hpp"  // for unpack, Element, Decorator, BorderStyle, ROUNDED, borderStyled, Elements, DASHED, DOUBLE, EMPTY, HEAVY, LIGHT, border, borderDashed, borderDouble, borderEmpty, borderHeavy, borderLight, borderRounded, borderWith, window
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
 #include "ftxui/dom/node.hpp"      // for Node, Elements
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
@@ -70,13 +71,13 @@ class Border : public Node {
                                  box.x_min + children_[1]->requirement().min_x);
       title_box.y_min = box.y_min;
       title_box.y_max = box.y_min;
-      children_[1]->SetBox(title_box);
+      children_[1]->SetBoxCached(title_box);
     }
     box.x_min++;
     box.x_max--;
     box.y_min++;
     box.y_max--;
-    children_[0]->SetBox(box);
+    children_[0]->SetBoxCached(box);
   }
 
   void Render(Screen& screen) override {
@@ -159,13 +160,13 @@ class BorderPixel : public Node {
       title_box.x_max = box.x_max - 1;
       title_box.y_min = box.y_min;
       title_box.y_max = box.y_min;
-      children_[1]->SetBox(title_box);
+      children_[1]->SetBoxCached(title_box);
     }
     box.x_min++;
     box.x_max--;
     box.y_min++;
     box.y_max--;
-    children_[0]->SetBox(box);
+    children_[0]->SetBoxCached(box);
   }
 
   void Render(Screen& screen) override {
@@ -225,7 +226,7 @@ class BorderPixel : public Node {
 /// └───────────┘
 /// ```
 Element border(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), ROUNDED);
+  return MakeNode<Border>(unpack(std::move(child)), ROUNDED);
 }
 
 /// @brief Same as border but with a constant Pixel around the element.
@@ -233,7 +234,7 @@ Element border(Element child) {
 /// @see border
 Decorator borderWith(const PixelStandalone& pixel) {
   return [pixel](Element child) {
-    return std::make_shared<BorderPixel>(unpack(std::move(child)), pixel);
+    return MakeNode<BorderPixel>(unpack(std::move(child)), pixel);
   };
 }
 
@@ -242,7 +243,7 @@ Decorator borderWith(const PixelStandalone& pixel) {
 /// @see border
 Decorator borderStyled(BorderStyle style) {
   return [style](Element child) {
-    return std::make_shared<Border>(unpack(std::move(child)), style);
+    return MakeNode<Border>(unpack(std::move(child)), style);
   };
 }
 
@@ -251,7 +252,7 @@ Decorator borderStyled(BorderStyle style) {
 /// @see border
 Decorator borderStyled(Color foreground_color) {
   return [foreground_color](Element child) {
-    return std::make_shared<Border>(unpack(std::move(child)), ROUNDED,
+    return MakeNode<Border>(unpack(std::move(child)), ROUNDED,
                                     foreground_color);
   };
 }
@@ -261,7 +262,7 @@ Decorator borderStyled(Color foreground_color) {
 /// @see border
 Decorator borderStyled(BorderStyle style, Color foreground_color) {
   return [style, foreground_color](Element child) {
-    return std::make_shared<Border>(unpack(std::move(child)), style,
+    return MakeNode<Border>(unpack(std::move(child)), style,
                                     foreground_color);
   };
 }
@@ -298,7 +299,7 @@ Decorator borderStyled(BorderStyle style, Color foreground_color) {
 /// ┗╍╍╍╍╍╍╍╍╍╍╍╍╍╍┛
 /// ```
 Element borderDashed(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), DASHED);
+  return MakeNode<Border>(unpack(std::move(child)), DASHED);
 }
 
 /// @brief Draw a light border around the element.
@@ -333,7 +334,7 @@ Element borderDashed(Element child) {
 /// └──────────────┘
 /// ```
 Element borderLight(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), LIGHT);
+  return MakeNode<Border>(unpack(std::move(child)), LIGHT);
 }
 
 /// @brief Draw a heavy border around the element.
@@ -368,7 +369,7 @@ Element borderLight(Element child) {
 /// ┗━━━━━━━━━━━━━━┛
 /// ```
 Element borderHeavy(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), HEAVY);
+  return MakeNode<Border>(unpack(std::move(child)), HEAVY);
 }
 
 /// @brief Draw a double border around the element.
@@ -403,7 +404,7 @@ Element borderHeavy(Element child) {
 /// ╚══════════════╝
 /// ```
 Element borderDouble(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), DOUBLE);
+  return MakeNode<Border>(unpack(std::move(child)), DOUBLE);
 }
 
 /// @brief Draw a rounded border around the element.
@@ -438,7 +439,7 @@ Element borderDouble(Element child) {
 /// ╰──────────────╯
 /// ```
 Element borderRounded(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), ROUNDED);
+  return MakeNode<Border>(unpack(std::move(child)), ROUNDED);
 }
 
 /// @brief Draw an empty border around the element.
@@ -473,7 +474,7 @@ Element borderRounded(Element child) {
 ///
 /// ```
 Element borderEmpty(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), EMPTY);
+  return MakeNode<Border>(unpack(std::move(child)), EMPTY);
 }
 
 /// @brief Draw window with a title and a border around the element.
@@ -505,7 +506,7 @@ Element borderEmpty(Element child) {
 /// └───────┘
 /// ```
 Element window(Element title, Element content, BorderStyle border) {
-  return std::make_shared<Border>(unpack(std::move(content), std::move(title)),
+  return MakeNode<Border>(unpack(std::move(content), std::move(title)),
                                   border);
 }
 }  // namespace ftxui
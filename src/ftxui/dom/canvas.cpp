@@ -3,18 +3,19 @@
 // the LICENSE file.
 #include "ftxui/dom/canvas.hpp"
 
-#include <algorithm>               // for max, min
-#include <cmath>                   // for abs
+#include <algorithm>               // for max, min, sort, fill
+#include <cmath>                   // for abs, lround
 #include <cstdint>                 // for uint8_t
 #include <cstdlib>                 // for abs
 #include <ftxui/screen/color.hpp>  // for Color
 #include <functional>              // for function
 #include <map>                     // for map
-#include <memory>                  // for make_shared
+#include <memory>                  // for shared_ptr
 #include <utility>                 // for move, pair
 #include <vector>                  // for vector
 
 #include "ftxui/dom/elements.hpp"     // for Element, canvas
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
 #include "ftxui/dom/node.hpp"         // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
@@ -66,6 +67,17 @@ constexpr uint8_t g_map_braille[2][4][2] = {
     },
 };
 
+// The same dots, as the bits of the offset from U+2800: the upper two bits go
+// to the second byte, the others to the third.
+// NOLINTNEXTLINE
+constexpr uint8_t g_map_braille_bit[2][4] = {
+    {0b00000001, 0b00000010, 0b00000100, 0b01000000},  // NOLINT
+    {0b00001000, 0b00010000, 0b00100000, 0b10000000},  // NOLINT
+};
+
+// The braille character without any dot: U+2800.
+constexpr std::string_view g_braille_blank = "\xE2\xA0\x80";
+
 // NOLINTNEXTLINE
 constexpr std::string_view g_map_block[] = {
     " ", "▘", "▖", "▌", "▝", "▀", "▞", "▛",
@@ -82,6 +94,104 @@ const std::map<std::string_view, uint8_t> g_map_block_inversed = {
 
 constexpr auto nostyle = [](Pixel& /*pixel*/) {};
 
+// The shapes made of braille dots, for any stylizer. The Color overloads call
+// theirs inline, instead of through a Canvas::Stylizer.
+template <typename F>
+void PointLine(Canvas& c, int x1, int y1, int x2, int y2, const F& style) {
+  const int dx = std::abs(x2 - x1);
+  const int dy = std::abs(y2 - y1);
+  const int sx = x1 < x2 ? 1 : -1;
+  const int sy = y1 < y2 ? 1 : -1;
+  const int length = std::max(dx, dy);
+
+  const auto is_in = [&](int x, int y) {
+    return x >= 0 && x < c.subpixel_width() && y >= 0 &&
+           y < c.subpixel_height();
+  };
+  if (!is_in(x1, y1) && !is_in(x2, y2))
+    return;
+
+  if (dx + dx > c.subpixel_width() * c.subpixel_height())
+    return;
+
+  int error = dx - dy;
+  for (int i = 0; i < length; ++i) {
+    c.DrawPoint(x1, y1, true, style);
+    if (2 * error >= -dy) {
+      error -= dy;
+      x1 += sx;
+    }
+    if (2 * error <= dx) {
+      error += dx;
+      y1 += sy;
+    }
+  }
+  c.DrawPoint(x2, y2, true, style);
+}
+
+template <typename F>
+void PointEllipse(Canvas& c, int x1, int y1, int r1, int r2, const F& s) {
+  int x = -r1;
+  int y = 0;
+  int e2 = r2;
+  int dx = (1 + 2 * x) * e2 * e2;
+  int dy = x * x;
+  int err = dx + dy;
+
+  do {  // NOLINT
+    c.DrawPoint(x1 - x, y1 + y, true, s);
+    c.DrawPoint(x1 + x, y1 + y, true, s);
+    c.DrawPoint(x1 + x, y1 - y, true, s);
+    c.DrawPoint(x1 - x, y1 - y, true, s);
+    e2 = 2 * err;
+    if (e2 >= dx) {
+      x++;
+      err += dx += 2 * r2 * r2;
+    }
+    if (e2 <= dy) {
+      y++;
+      err += dy += 2 * r1 * r1;
+    }
+  } while (x <= 0);
+
+  while (y++ < r2) {
+    c.DrawPoint(x1, y1 + y, true, s);
+    c.DrawPoint(x1, y1 - y, true, s);
+  }
+}
+
+template <typename F>
+void PointEllipseFilled(Canvas& c, int x1, int y1, int r1, int r2, const F& s) {
+  int x = -r1;
+  int y = 0;
+  int e2 = r2;
+  int dx = (1 + 2 * x) * e2 * e2;
+  int dy = x * x;
+  int err = dx + dy;
+
+  do {  // NOLINT
+    for (int xx = x1 + x; xx <= x1 - x; ++xx) {
+      c.DrawPoint(xx, y1 + y, true, s);
+      c.DrawPoint(xx, y1 - y, true, s);
+    }
+    e2 = 2 * err;
+    if (e2 >= dx) {
+      x++;
+      err += dx += 2 * r2 * r2;
+    }
+    if (e2 <= dy) {
+      y++;
+      err += dy += 2 * r1 * r1;
+    }
+  } while (x <= 0);
+
+  while (y++ < r2) {
+    for (int yy = y1 - y; yy <= y1 + y; ++yy) {
+      c.DrawPoint(x1, yy, true, s);
+    }
+  }
+}
+
 }  // namespace
 
 /// @brief Constructor.
@@ -104,7 +214,7 @@ Canvas::Canvas(int width, int height)
 /// @param y the y coordinate of the dot.
 /// @param value whether the dot is filled or not.
 void Canvas::DrawPoint(int x, int y, bool value) {
-  DrawPoint(x, y, value, [](Pixel& /*pixel*/) {});
+  DrawPoint(x, y, value, nostyle);
 }
 
 /// @brief Draw a braille dot.
@@ -137,10 +247,11 @@ void Canvas::DrawPointOn(int x, int y) {
     return;
 
   const auto xy = x / 2 + (y / 4) * width();
+  dirty_rows_[y / 4] = 1;
   Pixel& data = pixels_[xy];
   Cell&  cell = cells_ [xy];
   if (cell.type != Cell::kBraille) {
-    data.grapheme = ' ';  // 3 bytes.
+    data.grapheme = g_braille_blank;
     cell.type = Cell::kBraille;
   }
 
@@ -156,10 +267,11 @@ void Canvas::DrawPointOff(int x, int y) {
     return;
 
   const auto xy = x / 2 + (y / 4) * width();
+  dirty_rows_[y / 4] = 1;
   Pixel& data = pixels_[xy];
   Cell&  cell = cells_ [xy];
   if (cell.type != Cell::kBraille) {
-    data.grapheme = ' ';  // 3 byt
+    data.grapheme = g_braille_blank;
     cell.type = Cell::kBraille;
   }
 
@@ -176,10 +288,11 @@ void Canvas::DrawPointToggle(int x, int y) {
     return;
 
   const auto xy = x / 2 + (y / 4) * width();
+  dirty_rows_[y / 4] = 1;
   Pixel& data = pixels_[xy];
   Cell&  cell = cells_ [xy];
   if (cell.type != Cell::kBraille) {
-    data.grapheme = ' ';  // 3 byt
+    data.grapheme = g_braille_blank;
     cell.type = Cell::kBraille;
   }
 
@@ -193,7 +306,7 @@ void Canvas::DrawPointToggle(int x, int y) {
 /// @param x2 the x coordinate of the second dot.
 /// @param y2 the y coordinate of the second dot.
 void Canvas::DrawPointLine(int x1, int y1, int x2, int y2) {
-  DrawPointLine(x1, y1, x2, y2, [](Pixel& /*pixel*/) {});
+  PointLine(*this, x1, y1, x2, y2, nostyle);
 }
 
 /// @brief Draw a line made of braille dots.
@@ -203,8 +316,8 @@ void Canvas::DrawPointLine(int x1, int y1, int x2, int y2) {
 /// @param y2 the y coordinate of the second dot.
 /// @param color the color of the line.
 void Canvas::DrawPointLine(int x1, int y1, int x2, int y2, const Color& color) {
-  DrawPointLine(x1, y1, x2, y2,
-                [color](Pixel& p) { p.style.foreground_color = color; });
+  PointLine(*this, x1, y1, x2, y2,
+            [color](Pixel& p) { p.style.foreground_color = color; });
 }
 
 /// @brief Draw a line made of braille dots.
@@ -218,31 +331,7 @@ void Canvas::DrawPointLine(int x1,
                            int x2,
                            int y2,
                            const Stylizer& style) {
-  const int dx = std::abs(x2 - x1);
-  const int dy = std::abs(y2 - y1);
-  const int sx = x1 < x2 ? 1 : -1;
-  const int sy = y1 < y2 ? 1 : -1;
-  const int length = std::max(dx, dy);
-
-  if (!IsIn(x1, y1) && !IsIn(x2, y2))
-    return;
-
-  if (dx + dx > subpixel_width() * subpixel_height())
-    return;
-
-  int error = dx - dy;
-  for (int i = 0; i < length; ++i) {
-    DrawPoint(x1, y1, true, style);
-    if (2 * error >= -dy) {
-      error -= dy;
-      x1 += sx;
-    }
-    if (2 * error <= dx) {
-      error += dx;
-      y1 += sy;
-    }
-  }
-  DrawPoint(x2, y2, true, style);
+  PointLine(*this, x1, y1, x2, y2, style);
 }
 
 /// @brief Draw a circle made of braille dots.
@@ -250,7 +339,7 @@ void Canvas::DrawPointLine(int x1,
 /// @param y the y coordinate of the center of the circle.
 /// @param radius the radius of the circle.
 void Canvas::DrawPointCircle(int x, int y, int radius) {
-  DrawPointCircle(x, y, radius, [](Pixel& /*pixel*/) {});
+  DrawPointEllipse(x, y, radius, radius);
 }
 
 /// @brief Draw a circle made of braille dots.
@@ -259,8 +348,7 @@ void Canvas::DrawPointCircle(int x, int y, int radius) {
 /// @param radius the radius of the circle.
 /// @param color the color of the circle.
 void Canvas::DrawPointCircle(int x, int y, int radius, const Color& color) {
-  DrawPointCircle(x, y, radius,
-                  [color](Pixel& p) { p.style.foreground_color = color; });
+  DrawPointEllipse(x, y, radius, radius, color);
 }
 
 /// @brief Draw a circle made of braille dots.
@@ -277,7 +365,7 @@ void Canvas::DrawPointCircle(int x, int y, int radius, const Stylizer& style) {
 /// @param y the y coordinate of the center of the circle.
 /// @param radius the radius of the circle.
 void Canvas::DrawPointCircleFilled(int x, int y, int radius) {
-  DrawPointCircleFilled(x, y, radius, [](Pixel& /*pixel*/) {});
+  DrawPointEllipseFilled(x, y, radius, radius);
 }
 
 /// @brief Draw a filled circle made of braille dots.
@@ -289,8 +377,7 @@ void Canvas::DrawPointCircleFilled(int x,
                                    int y,
                                    int radius,
                                    const Color& color) {
-  DrawPointCircleFilled(x, y, radius,
-                        [color](Pixel& p) { p.style.foreground_color = color; });
+  DrawPointEllipseFilled(x, y, radius, radius, color);
 }
 
 /// @brief Draw a filled circle made of braille dots.
@@ -311,7 +398,7 @@ void Canvas::DrawPointCircleFilled(int x,
 /// @param r1 the radius of the ellipse along the x axis.
 /// @param r2 the radius of the ellipse along the y axis.
 void Canvas::DrawPointEllipse(int x, int y, int r1, int r2) {
-  DrawPointEllipse(x, y, r1, r2, [](Pixel& /*pixel*/) {});
+  PointEllipse(*this, x, y, r1, r2, nostyle);
 }
 
 /// @brief Draw an ellipse made of braille dots.
@@ -325,8 +412,8 @@ void Canvas::DrawPointEllipse(int x,
                               int r1,
                               int r2,
                               const Color& color) {
-  DrawPointEllipse(x, y, r1, r2,
-                   [color](Pixel& p) { p.style.foreground_color = color; });
+  PointEllipse(*this, x, y, r1, r2,
+               [color](Pixel& p) { p.style.foreground_color = color; });
 }
 
 /// @brief Draw an ellipse made of braille dots.
@@ -340,33 +427,7 @@ void Canvas::DrawPointEllipse(int x1,
                               int r1,
                               int r2,
                               const Stylizer& s) {
-  int x = -r1;
-  int y = 0;
-  int e2 = r2;
-  int dx = (1 + 2 * x) * e2 * e2;
-  int dy = x * x;
-  int err = dx + dy;
-
-  do {  // NOLINT
-    DrawPoint(x1 - x, y1 + y, true, s);
-    DrawPoint(x1 + x, y1 + y, true, s);
-    DrawPoint(x1 + x, y1 - y, true, s);
-    DrawPoint(x1 - x, y1 - y, true, s);
-    e2 = 2 * err;
-    if (e2 >= dx) {
-      x++;
-      err += dx += 2 * r2 * r2;
-    }
-    if (e2 <= dy) {
-      y++;
-      err += dy += 2 * r1 * r1;
-    }
-  } while (x <= 0);
-
-  while (y++ < r2) {
-    DrawPoint(x1, y1 + y, true, s);
-    DrawPoint(x1, y1 - y, true, s);
-  }
+  PointEllipse(*this, x1, y1, r1, r2, s);
 }
 
 /// @brief Draw a filled ellipse made of braille dots.
@@ -375,7 +436,7 @@ void Canvas::DrawPointEllipse(int x1,
 /// @param r1 the radius of the ellipse along the x axis.
 /// @param r2 the radius of the ellipse along the y axis.
 void Canvas::DrawPointEllipseFilled(int x1, int y1, int r1, int r2) {
-  DrawPointEllipseFilled(x1, y1, r1, r2, [](Pixel& /*pixel*/) {});
+  PointEllipseFilled(*this, x1, y1, r1, r2, nostyle);
 }
 
 /// @brief Draw a filled ellipse made of braille dots.
@@ -389,8 +450,8 @@ void Canvas::DrawPointEllipseFilled(int x1,
                                     int r1,
                                     int r2,
                                     const Color& color) {
-  DrawPointEllipseFilled(x1, y1, r1, r2,
-                         [color](Pixel& p) { p.style.foreground_color = color; });
+  PointEllipseFilled(*this, x1, y1, r1, r2,
+                     [color](Pixel& p) { p.style.foreground_color = color; });
 }
 
 /// @brief Draw a filled ellipse made of braille dots.
@@ -404,34 +465,214 @@ void Canvas::DrawPointEllipseFilled(int x1,
                                     int r1,
                                     int r2,
                                     const Stylizer& s) {
-  int x = -r1;
-  int y = 0;
-  int e2 = r2;
-  int dx = (1 + 2 * x) * e2 * e2;
-  int dy = x * x;
-  int err = dx + dy;
+  PointEllipseFilled(*this, x1, y1, r1, r2, s);
+}
 
-  do {  // NOLINT
-    for (int xx = x1 + x; xx <= x1 - x; ++xx) {
-      DrawPoint(xx, y1 + y, true, s);
-      DrawPoint(xx, y1 - y, true, s);
+/// @brief Draw braille dots.
+/// @param points the dots.
+/// @param count the number of dots.
+void Canvas::DrawPoints(const Point* points, size_t count) {
+  RasterizePoints(points, count);
+}
+
+/// @brief Draw braille dots.
+/// @param points the dots.
+/// @param count the number of dots.
+/// @param color the color of the dots.
+///
+/// ### Example
+///
+/// ```cpp
+/// std::vector<Canvas::Point> points = ...;
+/// canvas.DrawPoints(points.data(), points.size(), Color::Red);
+/// ```
+void Canvas::DrawPoints(const Point* points, size_t count, const Color& color) {
+  DrawPoints(points, count,
+             [color](Pixel& p) { p.style.foreground_color = color; });
+}
+
+/// @brief Draw lines of braille dots, joining consecutive points.
+/// @param points the points.
+/// @param count the number of points.
+void Canvas::DrawPolyline(const Point* points, size_t count) {
+  RasterizePolyline(points, count);
+}
+
+/// @brief Draw lines of braille dots, joining consecutive points.
+/// @param points the points.
+/// @param count the number of points.
+/// @param color the color of the lines.
+void Canvas::DrawPolyline(const Point* points,
+                          size_t count,
+                          const Color& color) {
+  DrawPolyline(points, count,
+               [color](Pixel& p) { p.style.foreground_color = color; });
+}
+
+/// @brief Draw a filled polygon made of braille dots.
+/// @param points the vertices of the polygon.
+/// @param count the number of vertices.
+void Canvas::DrawPolygonFilled(const Point* points, size_t count) {
+  RasterizePolygonFilled(points, count);
+}
+
+/// @brief Draw a filled polygon made of braille dots.
+/// @param points the vertices of the polygon.
+/// @param count the number of vertices.
+/// @param color the color of the polygon.
+void Canvas::DrawPolygonFilled(const Point* points,
+                               size_t count,
+                               const Color& color) {
+  DrawPolygonFilled(points, count,
+                    [color](Pixel& p) { p.style.foreground_color = color; });
+}
+
+// Start a new batch of dots. No cell was touched by it yet.
+void Canvas::BeginBatch() {
+  touched_.clear();
+  if (dots_.size() != cells_.size()) {
+    dots_.assign(cells_.size(), 0);
+  }
+}
+
+// Set the braille dot (x, y), inside the canvas. It is only accumulated into
+// |dots_|, a byte per cell, until EndBatch().
+FTXUI_FORCE_INLINE()
+void Canvas::Plot(int x, int y) {
+  const unsigned xy = unsigned(x) / 2 + (unsigned(y) / 4) * unsigned(dimx_);
+  uint8_t& dots = dots_[xy];
+  if (dots == 0) {
+    touched_.push_back(xy);
+  }
+  dots |= g_map_braille_bit[x & 1][y & 3];
+}
+
+// Write the dots accumulated into the braille characters of the cells.
+void Canvas::EndBatch() {
+  for (const int xy : touched_) {
+    Pixel& data = data_[xy];
+    if (cells_[xy].type != Cell::kBraille) {
+      data.grapheme = g_braille_blank;
+      cells_[xy].type = Cell::kBraille;
     }
-    e2 = 2 * err;
-    if (e2 >= dx) {
-      x++;
-      err += dx += 2 * r2 * r2;
+    const uint8_t dots = dots_[xy];
+    data.grapheme[1] |= char(dots >> 6);    // NOLINT
+    data.grapheme[2] |= char(dots & 0x3F);  // NOLINT
+    dots_[xy] = 0;
+    dirty_rows_[xy / dimx_] = 1;
+  }
+}
+
+// Set the braille dots from (x_min, y) to (x_max, y), clipped to the canvas.
+void Canvas::PlotSpan(int x_min, int x_max, int y) {
+  if (y < 0 || y >= subpixel_height()) {
+    return;
+  }
+  x_min = std::max(x_min, 0);
+  x_max = std::min(x_max, subpixel_width() - 1);
+  for (int x = x_min; x <= x_max; ++x) {
+    Plot(x, y);
+  }
+}
+
+void Canvas::RasterizePoints(const Point* points, size_t count) {
+  BeginBatch();
+  const unsigned width = subpixel_width();
+  const unsigned height = subpixel_height();
+  for (size_t i = 0; i < count; ++i) {
+    // Negative coordinates wrap around, and are rejected too.
+    if (unsigned(points[i].x) < width && unsigned(points[i].y) < height) {
+      Plot(points[i].x, points[i].y);
     }
-    if (e2 <= dy) {
-      y++;
-      err += dy += 2 * r1 * r1;
+  }
+  EndBatch();
+}
+
+// Set the braille dots of the line from |a| to |b|, like DrawPointLine().
+void Canvas::RasterizeSegment(Point a, Point b) {
+  // Skip the segments entirely on one side of the canvas.
+  const int width = subpixel_width();
+  const int height = subpixel_height();
+  if ((a.x < 0 && b.x < 0) || (a.y < 0 && b.y < 0) ||
+      (a.x >= width && b.x >= width) || (a.y >= height && b.y >= height)) {
+    return;
+  }
+
+  const int dx = std::abs(b.x - a.x);
+  const int dy = std::abs(b.y - a.y);
+  const int sx = a.x < b.x ? 1 : -1;
+  const int sy = a.y < b.y ? 1 : -1;
+  int error = dx - dy;
+  for (int step = std::max(dx, dy); step > 0; --step) {
+    if (IsIn(a.x, a.y)) {
+      Plot(a.x, a.y);
     }
-  } while (x <= 0);
+    if (2 * error >= -dy) {
+      error -= dy;
+      a.x += sx;
+    }
+    if (2 * error <= dx) {
+      error += dx;
+      a.y += sy;
+    }
+  }
+  if (IsIn(b.x, b.y)) {
+    Plot(b.x, b.y);
+  }
+}
 
-  while (y++ < r2) {
-    for (int yy = y1 - y; yy <= y1 + y; ++yy) {
-      DrawPoint(x1, yy, true, s);
+void Canvas::RasterizePolyline(const Point* points, size_t count) {
+  BeginBatch();
+  if (count == 1) {
+    RasterizeSegment(points[0], points[0]);
+  }
+  for (size_t i = 1; i < count; ++i) {
+    RasterizeSegment(points[i - 1], points[i]);
+  }
+  EndBatch();
+}
+
+void Canvas::RasterizePolygonFilled(const Point* points, size_t count) {
+  BeginBatch();
+  if (count == 0) {
+    EndBatch();
+    return;
+  }
+
+  // The outline. The scanlines below cover the inside.
+  for (size_t i = 0; i < count; ++i) {
+    RasterizeSegment(points[i], points[(i + 1) % count]);
+  }
+
+  int y_min = points[0].y;
+  int y_max = points[0].y;
+  for (size_t i = 1; i < count; ++i) {
+    y_min = std::min(y_min, points[i].y);
+    y_max = std::max(y_max, points[i].y);
+  }
+  y_min = std::max(y_min, 0);
+  y_max = std::min(y_max, subpixel_height() - 1);
+
+  // Fill between pairs of crossings of the scanline with the edges. An edge
+  // includes its upper end only, so that a vertex is crossed once.
+  std::vector<int> crossings;
+  for (int y = y_min; y <= y_max; ++y) {
+    crossings.clear();
+    for (size_t i = 0; i < count; ++i) {
+      const Point& a = points[i];
+      const Point& b = points[(i + 1) % count];
+      if ((a.y <= y) == (b.y <= y)) {
+        continue;
+      }
+      const double t = double(y - a.y) / double(b.y - a.y);
+      crossings.push_back(int(std::lround(a.x + t * (b.x - a.x))));
+    }
+    std::sort(crossings.begin(), crossings.end());
+    for (size_t i = 0; i + 1 < crossings.size(); i += 2) {
+      PlotSpan(crossings[i], crossings[i + 1], y);
     }
   }
+  EndBatch();
 }
 
 /// @brief Draw a block.
@@ -475,6 +716,7 @@ void Canvas::DrawBlockOn(int x, int y) {
   y /= 2;
 
   const auto xy = x / 2 + (y / 2) * width();
+  dirty_rows_[y / 2] = 1;
   Pixel& data = pixels_[xy];
   Cell&  cell = cells_ [xy];
   if (cell.type != Cell::kBlock) {
@@ -496,6 +738,7 @@ void Canvas::DrawBlockOff(int x, int y) {
     return;
 
   const auto xy = x / 2 + (y / 4) * width();
+  dirty_rows_[y / 4] = 1;
   Pixel& data = pixels_[xy];
   Cell&  cell = cells_ [xy];
   if (cell.type != Cell::kBlock) {
@@ -519,6 +762,7 @@ void Canvas::DrawBlockToggle(int x, int y) {
     return;
 
   const auto xy = x / 2 + (y / 4) * width();
+  dirty_rows_[y / 4] = 1;
   Pixel& data = pixels_[xy];
   Cell&  cell = cells_ [xy];
   if (cell.type != Cell::kBlock) {
@@ -823,6 +1067,7 @@ void Canvas::DrawText(int x,
     }
 
     const auto xy = x / 2 + (y / 4) * width();
+    dirty_rows_[y / 4] = 1;
     Pixel& data = pixels_[xy];
     Cell&  cell = cells_ [xy];
     cell.type = Cell::kCell;
@@ -838,6 +1083,7 @@ void Canvas::DrawText(int x,
 /// @param p the pixel to draw.
 void Canvas::DrawPixel(int x, int y, const PixelStandalone& p) {
   const auto xy = x / 2 + (y / 4) * width();
+  dirty_rows_[y / 4] = 1;
   Pixel& data = pixels_[xy];
   Cell&  cell = cells_ [xy];
   cell.type = Cell::kCell;
@@ -861,6 +1107,7 @@ void Canvas::DrawImage(int x, int y, const Image& image) {
   for (int dy = dy_begin; dy < dy_end; ++dy) {
     for (int dx = dx_begin; dx < dx_end; ++dx) {
       const auto xy = (x + dx) + (y + dy) * width();
+      dirty_rows_[y + dy] = 1;
       Pixel& data = pixels_[xy];
       Cell& cell = cells_[xy];
       cell.type = Cell::kCell;
@@ -874,6 +1121,7 @@ void Canvas::DrawImage(int x, int y, const Image& image) {
 void Canvas::Style(int x, int y, const Stylizer& style) {
   if (IsIn(x, y)) {
      const auto xy = x / 2 + (y / 4) * width();
+     dirty_rows_[y / 4] = 1;
      style(pixels_[xy]);
   }
 }
@@ -912,7 +1160,7 @@ Element canvas(ConstRef<Canvas> canvas) {
     const Canvas& canvas() final { return *canvas_; }
     ConstRef<Canvas> canvas_;
   };
-  return std::make_shared<Impl>(canvas);
+  return MakeNode<Impl>(canvas);
 }
 
 /// @brief Produce an element drawing a canvas of requested size.
@@ -923,7 +1171,10 @@ Element canvas(int width, int height, std::function<void(Canvas&)> fn) {
   class Impl : public CanvasNodeBase {
    public:
     Impl(int width, int height, std::function<void(Canvas&)> fn)
-        : canvas_(width, height), fn_(std::move(fn)) {}
+        : canvas_(width, height), fn_(std::move(fn)) {
+      // The requirement follows the size drawn on the previous frame.
+      layout_cacheable_ = false;
+    }
 
     void ComputeRequirement() final {
       requirement_.min_x = (canvas_.width() + 1) / 2;
@@ -942,7 +1193,7 @@ Element canvas(int width, int height, std::function<void(Canvas&)> fn) {
     Canvas canvas_;
     std::function<void(Canvas&)> fn_;
   };
-  return std::make_shared<Impl>(width, height, std::move(fn));
+  return MakeNode<Impl>(width, height, std::move(fn));
 }
 
 /// @brief Produce an element drawing a canvas.
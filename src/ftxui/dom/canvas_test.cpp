@@ -4,9 +4,10 @@
 #include <gtest/gtest.h>
 #include <cstdint>  // for uint32_t
 #include <string>   // for allocator, string
+#include <vector>   // for vector
 
 #include "ftxui/dom/canvas.hpp"    // for Canvas
-#include "ftxui/dom/elements.hpp"  // for canvas
+#include "ftxui/dom/elements.hpp"  // for canvas, text, vbox
 #include "ftxui/dom/node.hpp"      // for Render
 #include "ftxui/screen/color.hpp"  // for Color, Color::Black, Color::Blue, Color::Red, Color::White, Color::Yellow, Color::Cyan, Color::Green
 #include "ftxui/screen/screen.hpp"    // for Screen
@@ -56,7 +57,7 @@ TEST(CanvasTest, GoldPointColor) {
   });
   Screen screen(30, 10);
   Render(screen, element);
-  EXPECT_EQ(Hash(screen.ToString()), 2295070594U) << screen.ToString();
+  EXPECT_EQ(Hash(screen.ToString()), 4230392380U) << screen.ToString();
 }
 
 TEST(CanvasTest, GoldBlock) {
@@ -89,7 +90,7 @@ TEST(CanvasTest, GoldBlockColor) {
   });
   Screen screen(30, 10);
   Render(screen, element);
-  EXPECT_EQ(Hash(screen.ToString()), 8392696U) << screen.ToString();
+  EXPECT_EQ(Hash(screen.ToString()), 1781414196U) << screen.ToString();
 }
 
 TEST(CanvasTest, GoldText) {
@@ -104,5 +105,107 @@ TEST(CanvasTest, GoldText) {
   EXPECT_EQ(Hash(screen.ToString()), 1074960375);
 }
 
+TEST(CanvasTest, DrawPoints) {
+  std::vector<Canvas::Point> points;
+  for (int i = 0; i < 40; ++i) {
+    points.push_back({(i * 7) % 23, (i * 5) % 17});
+  }
+  points.push_back({-1, 3});   // Outside.
+  points.push_back({3, 100});  // Outside.
+
+  Canvas expected(24, 20);
+  for (const auto& point : points) {
+    expected.DrawPoint(point.x, point.y, true, Color::Red);
+  }
+
+  Canvas c(24, 20);
+  c.DrawPoints(points.data(), points.size(), Color::Red);
+
+  Screen screen_expected(12, 5);
+  Screen screen(12, 5);
+  Render(screen_expected, canvas(expected));
+  Render(screen, canvas(c));
+  EXPECT_EQ(screen.ToString(), screen_expected.ToString());
+}
+
+TEST(CanvasTest, DrawPointsStylesOncePerCell) {
+  // 8 dots, all in the first cell, and 1 in the second one.
+  std::vector<Canvas::Point> points;
+  for (int y = 0; y < 4; ++y) {
+    points.push_back({0, y});
+    points.push_back({1, y});
+  }
+  points.push_back({2, 0});
+
+  Canvas c(4, 4);
+  int calls = 0;
+  c.DrawPoints(points.data(), points.size(), [&](Pixel&) { calls++; });
+  EXPECT_EQ(calls, 2);
+
+  Screen screen(2, 1);
+  Render(screen, canvas(c));
+  EXPECT_EQ(screen.ToString(), "⣿⠁");
+}
+
+TEST(CanvasTest, DrawPointTemplated) {
+  Canvas c(4, 4);
+  int calls = 0;
+  c.DrawPoint(1, 1, true, [&](Pixel& p) {
+    p.style.bold = true;
+    calls++;
+  });
+  c.DrawPoint(100, 1, true, [&](Pixel&) { calls++; });
+  EXPECT_EQ(calls, 1);
+  EXPECT_TRUE(c.PixelAt(0, 0).style.bold);
+}
+
+TEST(CanvasTest, DrawPolyline) {
+  const std::vector<Canvas::Point> points = {{0, 0}, {9, 7}, {15, 2}, {3, 11}};
+
+  Canvas expected(16, 12);
+  for (size_t i = 1; i < points.size(); ++i) {
+    expected.DrawPointLine(points[i - 1].x, points[i - 1].y, points[i].x,
+                           points[i].y);
+  }
+
+  Canvas c(16, 12);
+  c.DrawPolyline(points.data(), points.size());
+
+  Screen screen_expected(8, 3);
+  Screen screen(8, 3);
+  Render(screen_expected, canvas(expected));
+  Render(screen, canvas(c));
+  EXPECT_EQ(screen.ToString(), screen_expected.ToString());
+}
+
+TEST(CanvasTest, DrawPolygonFilled) {
+  Canvas c(8, 8);
+  const std::vector<Canvas::Point> square = {{0, 0}, {7, 0}, {7, 7}, {0, 7}};
+  c.DrawPolygonFilled(square.data(), square.size());
+
+  Screen screen(4, 2);
+  Render(screen, canvas(c));
+  EXPECT_EQ(screen.ToString(), "⣿⣿⣿⣿\r\n⣿⣿⣿⣿");
+
+  // A triangle: the left column is filled, the right one is mostly empty.
+  Canvas triangle(8, 8);
+  const std::vector<Canvas::Point> points = {{0, 0}, {7, 7}, {0, 7}};
+  triangle.DrawPolygonFilled(points.data(), points.size());
+  Screen screen_triangle(4, 2);
+  Render(screen_triangle, canvas(triangle));
+  EXPECT_EQ(screen_triangle.ToString(), "⣷⣄  \r\n⣿⣿⣷⣄");
+}
+
+TEST(CanvasTest, BlankRowsAreOpaque) {
+  Canvas c(8, 8);
+  c.DrawText(0, 0, "x");
+
+  // The rows never drawn into still cover what was drawn before.
+  Screen screen(4, 2);
+  Render(screen, vbox({text("abcd"), text("efgh")}));
+  Render(screen, canvas(c));
+  EXPECT_EQ(screen.ToString(), "x   \r\n    ");
+}
+
 }  // namespace ftxui
 // NOLINTEND
@@ -3,7 +3,7 @@
 // the LICENSE file.
 #include <algorithm>  // for min, max
 #include <cstddef>    // for size_t
-#include <memory>  // for __shared_ptr_access, shared_ptr, allocator_traits<>::value_type, make_shared
+#include <memory>  // for __shared_ptr_access, shared_ptr, allocator_traits<>::value_type
 #include <tuple>   // for ignore
 #include <utility>  // for move, swap
 #include <vector>   // for vector
@@ -11,6 +11,7 @@
 #include "ftxui/dom/elements.hpp"  // for Element, Elements, flexbox, hflow, vflow
 #include "ftxui/dom/flexbox_config.hpp"  // for FlexboxConfig, FlexboxConfig::Direction, FlexboxConfig::Direction::Column, FlexboxConfig::AlignContent, FlexboxConfig::Direction::ColumnInversed, FlexboxConfig::Direction::Row, FlexboxConfig::JustifyContent, FlexboxConfig::Wrap, FlexboxConfig::AlignContent::FlexStart, FlexboxConfig::Direction::RowInversed, FlexboxConfig::JustifyContent::FlexStart, FlexboxConfig::Wrap::Wrap
 #include "ftxui/dom/flexbox_helper.hpp"  // for Block, Global, Compute
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
 #include "ftxui/dom/node.hpp"            // for Node, Elements, Node::Status
 #include "ftxui/dom/requirement.hpp"     // for Requirement
 #include "ftxui/dom/selection.hpp"       // for Selection
@@ -58,6 +59,8 @@ class Flexbox : public Node {
       : Node(std::move(children)),
         config_(config),
         config_normalized_(Normalize(config)) {
+    // The requirement depends on the box of the previous layout iteration.
+    layout_cacheable_ = false;
     requirement_.flex_grow_x = 1;
     requirement_.flex_grow_y = 0;
 
@@ -93,7 +96,7 @@ class Flexbox : public Node {
   void ComputeRequirement() override {
     requirement_ = Requirement{};
     for (auto& child : children_) {
-      child->ComputeRequirement();
+      child->ComputeRequirementCached();
     }
     global_ = flexbox_helper::Global();
     global_.config = config_normalized_;
@@ -163,7 +166,7 @@ class Flexbox : public Node {
       children_box.y_max = box.y_min + b.y + b.dim_y - 1;
 
       const Box intersection = Box::Intersection(children_box, box);
-      child->SetBox(intersection);
+      child->SetBoxCached(intersection);
 
       need_iteration_ |= (intersection != children_box);
     }
@@ -249,7 +252,7 @@ class Flexbox : public Node {
 //  )
 /// ```
 Element flexbox(Elements children, FlexboxConfig config) {
-  return std::make_shared<Flexbox>(std::move(children), config);
+  return MakeNode<Flexbox>(std::move(children), config);
 }
 
 /// @brief A container displaying elements in rows from left to right. When
@@ -2,10 +2,11 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include <algorithm>  // for max, min
-#include <memory>     // for make_shared, __shared_ptr_access
+#include <memory>     // for __shared_ptr_access
 #include <utility>    // for move
 
 #include "ftxui/dom/elements.hpp"  // for Element, unpack, Elements, focus, frame, select, xframe, yframe
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
 #include "ftxui/dom/node.hpp"         // for Node, Elements
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
@@ -32,7 +33,7 @@ class Focus : public Node {
 
   void SetBox(Box box) override {
     Node::SetBox(box);
-    children_[0]->SetBox(box);
+    children_[0]->SetBoxCached(box);
   }
 };
 
@@ -66,7 +67,7 @@ class Frame : public Node {
       children_box.y_max = box.y_min + internal_dimy - dy;
     }
 
-    children_[0]->SetBox(children_box);
+    children_[0]->SetBoxCached(children_box);
   }
 
   void Render(Screen& screen) override {
@@ -99,7 +100,7 @@ class FocusCursor : public Focus {
 /// @param child The element to be focused.
 /// @ingroup dom
 Element focus(Element child) {
-  return std::make_shared<Focus>(unpack(std::move(child)));
+  return MakeNode<Focus>(unpack(std::move(child)));
 }
 
 /// This is deprecated. Use `focus` instead.
@@ -116,7 +117,7 @@ Element select(Element child) {
 /// @see xframe
 /// @see yframe
 Element frame(Element child) {
-  return std::make_shared<Frame>(unpack(std::move(child)), true, true);
+  return MakeNode<Frame>(unpack(std::move(child)), true, true);
 }
 
 /// @brief Same as `frame`, but only on the x-axis.
@@ -124,7 +125,7 @@ Element frame(Element child) {
 /// @see xframe
 /// @see yframe
 Element xframe(Element child) {
-  return std::make_shared<Frame>(unpack(std::move(child)), true, false);
+  return MakeNode<Frame>(unpack(std::move(child)), true, false);
 }
 
 /// @brief Same as `frame`, but only on the y-axis.
@@ -132,7 +133,7 @@ Element xframe(Element child) {
 /// @see xframe
 /// @see yframe
 Element yframe(Element child) {
-  return std::make_shared<Frame>(unpack(std::move(child)), false, true);
+  return MakeNode<Frame>(unpack(std::move(child)), false, true);
 }
 
 /// @brief Same as `focus`, but set the cursor shape to be a still block.
@@ -145,7 +146,7 @@ Element yframe(Element child) {
 /// @see focusCursorUnderlineBlinking
 /// @ingroup dom
 Element focusCursorBlock(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
+  return MakeNode<FocusCursor>(unpack(std::move(child)),
                                        Screen::Cursor::Block);
 }
 
@@ -159,7 +160,7 @@ Element focusCursorBlock(Element child) {
 /// @see focusCursorUnderlineBlinking
 /// @ingroup dom
 Element focusCursorBlockBlinking(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
+  return MakeNode<FocusCursor>(unpack(std::move(child)),
                                        Screen::Cursor::BlockBlinking);
 }
 
@@ -173,7 +174,7 @@ Element focusCursorBlockBlinking(Element child) {
 /// @see focusCursorUnderlineBlinking
 /// @ingroup dom
 Element focusCursorBar(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
+  return MakeNode<FocusCursor>(unpack(std::move(child)),
                                        Screen::Cursor::Bar);
 }
 
@@ -187,7 +188,7 @@ Element focusCursorBar(Element child) {
 /// @see focusCursorUnderlineBlinking
 /// @ingroup dom
 Element focusCursorBarBlinking(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
+  return MakeNode<FocusCursor>(unpack(std::move(child)),
                                        Screen::Cursor::BarBlinking);
 }
 
@@ -201,7 +202,7 @@ Element focusCursorBarBlinking(Element child) {
 /// @see focusCursorUnderlineBlinking
 /// @ingroup dom
 Element focusCursorUnderline(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
+  return MakeNode<FocusCursor>(unpack(std::move(child)),
                                        Screen::Cursor::Underline);
 }
 
@@ -215,7 +216,7 @@ Element focusCursorUnderline(Element child) {
 /// @see focusCursorUnderlineBlinking
 /// @ingroup dom
 Element focusCursorUnderlineBlinking(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
+  return MakeNode<FocusCursor>(unpack(std::move(child)),
                                        Screen::Cursor::UnderlineBlinking);
 }
 
@@ -0,0 +1,93 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/dom/frame_arena.hpp"
+
+#include <atomic>   // for atomic, memory_order_relaxed, memory_order_acq_rel
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uintptr_t
+#include <new>      // for operator new, operator delete, align_val_t
+
+namespace ftxui {
+
+namespace {
+
+// Blocks are aligned on their size, so that the block of an allocation is
+// found by masking its address.
+constexpr size_t kBlockSize = 64 * 1024;
+thread_local FrameArena* g_current = nullptr;  // NOLINT
+
+}  // namespace
+
+struct FrameArena::Block {
+  // One reference per live allocation, plus one for the arena while it
+  // allocates from the block.
+  std::atomic<size_t> references{1};
+  size_t used = sizeof(Block);
+};
+
+FrameArena::~FrameArena() {
+  if (block_) {
+    Release(block_);
+  }
+}
+
+/// @brief Make the memory of the destroyed elements available again.
+/// @details If some elements are still alive, the arena moves to a new block
+/// instead. The previous one is freed with its last element.
+void FrameArena::Reset() {
+  if (!block_) {
+    return;
+  }
+  if (block_->references.load(std::memory_order_acquire) == 1) {
+    block_->used = sizeof(Block);
+    return;
+  }
+  Release(block_);
+  block_ = nullptr;
+}
+
+void* FrameArena::Allocate(size_t size, size_t alignment) {
+  size_t offset = 0;
+  if (block_) {
+    offset = (block_->used + alignment - 1) & ~(alignment - 1);
+  }
+  if (!block_ || offset + size > kBlockSize) {
+    if (block_) {
+      Release(block_);
+    }
+    void* memory = ::operator new(kBlockSize, std::align_val_t(kBlockSize));
+    block_ = new (memory) Block();
+    offset = (block_->used + alignment - 1) & ~(alignment - 1);
+  }
+  block_->used = offset + size;
+  block_->references.fetch_add(1, std::memory_order_relaxed);
+  return reinterpret_cast<char*>(block_) + offset;  // NOLINT
+}
+
+void FrameArena::Deallocate(void* pointer) {
+  const auto address = reinterpret_cast<uintptr_t>(pointer);  // NOLINT
+  Release(reinterpret_cast<Block*>(address & ~(kBlockSize - 1)));  // NOLINT
+}
+
+void FrameArena::Release(Block* block) {
+  if (block->references.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+    return;
+  }
+  block->~Block();
+  ::operator delete(block, std::align_val_t(kBlockSize));
+}
+
+FrameArena::Scope::Scope(FrameArena* arena) : previous_(g_current) {
+  g_current = arena;
+}
+
+FrameArena::Scope::~Scope() {
+  g_current = previous_;
+}
+
+FrameArena* FrameArena::Current() {
+  return g_current;
+}
+
+}  // namespace ftxui
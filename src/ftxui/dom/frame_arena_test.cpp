@@ -0,0 +1,86 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>  // for to_string, string
+
+#include "ftxui/dom/elements.hpp"     // for text, hbox, vbox, border, Element
+#include "ftxui/dom/frame_arena.hpp"  // for FrameArena
+#include "ftxui/dom/node.hpp"         // for Render
+#include "ftxui/screen/screen.hpp"    // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(FrameArenaTest, Scope) {
+  FrameArena arena;
+  EXPECT_EQ(FrameArena::Current(), nullptr);
+  {
+    FrameArena::Scope scope(&arena);
+    EXPECT_EQ(FrameArena::Current(), &arena);
+    {
+      FrameArena::Scope nested(nullptr);
+      EXPECT_EQ(FrameArena::Current(), nullptr);
+    }
+    EXPECT_EQ(FrameArena::Current(), &arena);
+  }
+  EXPECT_EQ(FrameArena::Current(), nullptr);
+}
+
+TEST(FrameArenaTest, Render) {
+  FrameArena arena;
+  for (int frame = 0; frame < 3; ++frame) {
+    arena.Reset();
+    FrameArena::Scope scope(&arena);
+    auto element = hbox({
+        text("a" + std::to_string(frame)),
+        text("b") | border,
+    });
+    Screen screen(5, 3);
+    Render(screen, element);
+    EXPECT_EQ(screen.ToString(),
+              "a" + std::to_string(frame) + "╭─╮\r\n"
+              "  │b│\r\n"
+              "  ╰─╯");
+  }
+}
+
+TEST(FrameArenaTest, KeepElementAcrossFrames) {
+  FrameArena arena;
+  Element kept;
+  {
+    FrameArena::Scope scope(&arena);
+    kept = text("kept") | border;
+  }
+
+  // The memory of |kept| must not be reused by the next frames.
+  for (int frame = 0; frame < 100; ++frame) {
+    arena.Reset();
+    FrameArena::Scope scope(&arena);
+    auto element = vbox({text("other frame " + std::to_string(frame))});
+    Screen screen(20, 1);
+    Render(screen, element);
+  }
+
+  Screen screen(6, 3);
+  Render(screen, kept);
+  EXPECT_EQ(screen.ToString(),
+            "╭────╮\r\n"
+            "│kept│\r\n"
+            "╰────╯");
+}
+
+TEST(FrameArenaTest, OutliveArena) {
+  Element kept;
+  {
+    FrameArena arena;
+    FrameArena::Scope scope(&arena);
+    kept = text("kept");
+  }
+  Screen screen(4, 1);
+  Render(screen, kept);
+  EXPECT_EQ(screen.ToString(), "kept");
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -2,10 +2,11 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include <ftxui/dom/direction.hpp>  // for Direction, Direction::Down, Direction::Left, Direction::Right, Direction::Up
-#include <memory>                   // for allocator, make_shared
+#include <memory>                   // for allocator
 #include <string>                   // for string
 
 #include "ftxui/dom/elements.hpp"  // for Element, gauge, gaugeDirection, gaugeDown, gaugeLeft, gaugeRight, gaugeUp
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
 #include "ftxui/dom/node.hpp"         // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
@@ -109,8 +110,11 @@ class Gauge : public Node {
       while (x < limit_int) {
         screen.PixelAt(x++, y).grapheme = charset_horizontal[9];  // NOLINT
       }
-      // NOLINTNEXTLINE
-      screen.PixelAt(x++, y).grapheme = charset_horizontal[int(9 * (limit - limit_int))];
+      // A full gauge has no partial cell.
+      if (x <= box_.x_max) {
+        // NOLINTNEXTLINE
+        screen.PixelAt(x++, y).grapheme = charset_horizontal[int(9 * (limit - limit_int))];
+      }
       while (x <= box_.x_max) {
         screen.PixelAt(x++, y).grapheme = charset_horizontal[0];
       }
@@ -139,8 +143,11 @@ class Gauge : public Node {
       while (y < limit_int) {
         screen.PixelAt(x, y++).grapheme = charset_vertical[8];  // NOLINT
       }
-      // NOLINTNEXTLINE
-      screen.PixelAt(x, y++).grapheme = charset_vertical[int(8 * (limit - limit_int))];
+      // A full gauge has no partial cell.
+      if (y <= box_.y_max) {
+        // NOLINTNEXTLINE
+        screen.PixelAt(x, y++).grapheme = charset_vertical[int(8 * (limit - limit_int))];
+      }
       while (y <= box_.y_max) {
         screen.PixelAt(x, y++).grapheme = charset_vertical[0];
       }
@@ -166,7 +173,7 @@ class Gauge : public Node {
 //  @param direction Direction of progress bars progression.
 /// @ingroup dom
 Element gaugeDirection(float progress, Direction direction) {
-  return std::make_shared<Gauge>(progress, direction);
+  return MakeNode<Gauge>(progress, direction);
 }
 
 /// @brief Draw a high definition progress bar progressing from left to right.
@@ -3,12 +3,13 @@
 // the LICENSE file.
 #include <algorithm>  // for max, min
 #include <cstddef>    // for size_t
-#include <memory>  // for __shared_ptr_access, shared_ptr, make_shared, allocator_traits<>::value_type
+#include <memory>  // for __shared_ptr_access, shared_ptr, allocator_traits<>::value_type
 #include <utility>  // for move
 #include <vector>   // for vector, __alloc_traits<>::value_type
 
 #include "ftxui/dom/box_helper.hpp"   // for Element, Compute
 #include "ftxui/dom/elements.hpp"     // for Elements, filler, Element, gridbox
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
 #include "ftxui/dom/node.hpp"         // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
@@ -46,13 +47,18 @@ class GridBox : public Node {
         line.push_back(filler());
       }
     }
+
+    // Also list the cells as children, for the default traversals of Node.
+    for (const auto& line : lines_) {
+      children_.insert(children_.end(), line.begin(), line.end());
+    }
   }
 
   void ComputeRequirement() override {
     requirement_ = Requirement{};
     for (auto& line : lines_) {
       for (auto& cell : line) {
-        cell->ComputeRequirement();
+        cell->ComputeRequirementCached();
       }
     }
 
@@ -125,17 +131,14 @@ class GridBox : public Node {
         box_x.x_min = x;
         x += elements_x[ix].size;
         box_x.x_max = x - 1;
-        lines_[iy][ix]->SetBox(box_x);
+        lines_[iy][ix]->SetBoxCached(box_x);
       }
     }
   }
 
   void Render(Screen& screen) override {
-    for (auto& line : lines_) {
-      for (auto& cell : line) {
-        cell->Render(screen);
-      }
-    }
+    // The cells don't overlap, so they can be rendered concurrently.
+    RenderDisjoint(screen);
   }
 
   int x_size = 0;
@@ -171,7 +174,7 @@ class GridBox : public Node {
 /// ╰──────────╯╰──────╯╰──────────╯
 /// ```
 Element gridbox(std::vector<Elements> lines) {
-  return std::make_shared<GridBox>(std::move(lines));
+  return MakeNode<GridBox>(std::move(lines));
 }
 
 }  // namespace ftxui
@@ -3,12 +3,13 @@
 // the LICENSE file.
 #include <algorithm>  // for max
 #include <cstddef>    // for size_t
-#include <memory>  // for __shared_ptr_access, shared_ptr, make_shared, allocator_traits<>::value_type
+#include <memory>  // for __shared_ptr_access, shared_ptr, allocator_traits<>::value_type
 #include <utility>  // for move
 #include <vector>   // for vector, __alloc_traits<>::value_type
 
 #include "ftxui/dom/box_helper.hpp"   // for Element, Compute
 #include "ftxui/dom/elements.hpp"     // for Element, Elements, hbox
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
 #include "ftxui/dom/node.hpp"         // for Node, Elements
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/dom/selection.hpp"    // for Selection
@@ -25,7 +26,7 @@ class HBox : public Node {
     requirement_ = Requirement{};
 
     for (auto& child : children_) {
-      child->ComputeRequirement();
+      child->ComputeRequirementCached();
 
       // Propagate the focused requirement.
       if (requirement_.focused.Prefer(child->requirement().focused)) {
@@ -58,7 +59,7 @@ class HBox : public Node {
     for (size_t i = 0; i < children_.size(); ++i) {
       box.x_min = x;
       box.x_max = x + elements[i].size - 1;
-      children_[i]->SetBox(box);
+      children_[i]->SetBoxCached(box);
       x = box.x_max + 1;
     }
   }
@@ -75,6 +76,10 @@ class HBox : public Node {
       child->Select(selection_saturated);
     }
   }
+  void Render(Screen& screen) override {
+    // The children don't overlap, so they can be rendered concurrently.
+    RenderDisjoint(screen);
+  }
 };
 
 }  // namespace
@@ -92,7 +97,7 @@ class HBox : public Node {
 /// });
 /// ```
 Element hbox(Elements children) {
-  return std::make_shared<HBox>(std::move(children));
+  return MakeNode<HBox>(std::move(children));
 }
 
 }  // namespace ftxui
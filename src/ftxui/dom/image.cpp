@@ -2,6 +2,7 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include "ftxui/screen/image.hpp"
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
 #include "ftxui/dom/node.hpp"         // for Node
 #include "ftxui/util/ref.hpp"         // for ConstRef
 
@@ -41,7 +42,7 @@ Element image(ConstRef<Image> image) {
     const Image& image() final { return *image_; }
     ConstRef<Image> image_;
   };
-  return std::make_shared<Impl>(image);
+  return MakeNode<Impl>(image);
 }
 
 /// @brief Produce an element drawing an image of requested size.
@@ -52,7 +53,10 @@ Element image(int width, int height, std::function<void(Image&)> fn) {
   class Impl : public ImageNodeBase {
    public:
     Impl(int width, int height, std::function<void(Image&)> fn)
-        : image_(width, height), fn_(std::move(fn)) {}
+        : image_(width, height), fn_(std::move(fn)) {
+      // The requirement follows the size drawn on the previous frame.
+      layout_cacheable_ = false;
+    }
 
     void ComputeRequirement() final {
       requirement_.min_x = (image_.width() + 1) / 2;
@@ -71,7 +75,7 @@ Element image(int width, int height, std::function<void(Image&)> fn) {
     Image image_;
     std::function<void(Image&)> fn_;
   };
-  return std::make_shared<Impl>(width, height, std::move(fn));
+  return MakeNode<Impl>(width, height, std::move(fn));
 }
 
 /// @brief Produce an element drawing a canvas.
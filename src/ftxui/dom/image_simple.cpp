@@ -2,6 +2,7 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include "ftxui/screen/image_simple.hpp"
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
 #include "ftxui/dom/node.hpp"         // for Node
 #include "ftxui/util/ref.hpp"         // for ConstRef
 
@@ -43,7 +44,7 @@ Element image_simple(ConstRef<ImageSimple> image) {
     const ImageSimple& image_simple() final { return *image_simple_; }
     ConstRef<ImageSimple> image_simple_;
   };
-  return std::make_shared<Impl>(image);
+  return MakeNode<Impl>(image);
 }
 
 /// @brief Produce an element drawing an image of requested size.
@@ -54,7 +55,10 @@ Element image_simple(int width, int height, std::function<void(ImageSimple&)> fn
   class Impl : public ImageSimpleNodeBase {
    public:
     Impl(int width, int height, std::function<void(ImageSimple&)> fn)
-        : image_simple_(width, height), fn_(std::move(fn)) {}
+        : image_simple_(width, height), fn_(std::move(fn)) {
+      // The requirement follows the size drawn on the previous frame.
+      layout_cacheable_ = false;
+    }
 
     void ComputeRequirement() final {
       requirement_.min_x = (image_simple_.width() + 1) / 2;
@@ -73,7 +77,7 @@ Element image_simple(int width, int height, std::function<void(ImageSimple&)> fn
     ImageSimple image_simple_;
     std::function<void(ImageSimple&)> fn_;
   };
-  return std::make_shared<Impl>(width, height, std::move(fn));
+  return MakeNode<Impl>(width, height, std::move(fn));
 }
 
 /// @brief Produce an element drawing a canvas.
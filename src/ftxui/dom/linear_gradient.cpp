@@ -5,12 +5,13 @@
 #include <cmath>                          // for fmod, cos, sin
 #include <cstddef>                        // for size_t
 #include <ftxui/dom/linear_gradient.hpp>  // for LinearGradient::Stop, LinearGradient
-#include <memory>    // for allocator_traits<>::value_type, make_shared
+#include <memory>    // for allocator_traits<>::value_type
 #include <optional>  // for optional, operator!=, operator<
 #include <utility>   // for move
 #include <vector>    // for vector
 
 #include "ftxui/dom/elements.hpp"  // for Element, Decorator, bgcolor, color
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
 #include "ftxui/screen/box.hpp"          // for Box
 #include "ftxui/screen/color.hpp"   // for Color, Color::Default, Color::Blue
@@ -249,7 +250,7 @@ LinearGradient& LinearGradient::Stop(Color c) {
 /// color(LinearGradient{0, {Color::Red, Color::Blue}}, text("Hello"))
 /// ```
 Element color(const LinearGradient& gradient, Element child) {
-  return std::make_shared<LinearGradientColor>(std::move(child), gradient,
+  return MakeNode<LinearGradientColor>(std::move(child), gradient,
                                                /*background_color*/ false);
 }
 
@@ -265,7 +266,7 @@ Element color(const LinearGradient& gradient, Element child) {
 /// bgcolor(LinearGradient{0, {Color::Red, Color::Blue}}, text("Hello"))
 /// ```
 Element bgcolor(const LinearGradient& gradient, Element child) {
-  return std::make_shared<LinearGradientColor>(std::move(child), gradient,
+  return MakeNode<LinearGradientColor>(std::move(child), gradient,
                                                /*background_color*/ true);
 }
 
@@ -2,13 +2,17 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include <ftxui/screen/box.hpp>  // for Box
+#include <algorithm>                // for max
 #include <string>
 #include <utility>  // for move
+#include <vector>   // for vector
 
 #include <cstddef>
 #include "ftxui/dom/node.hpp"
-#include "ftxui/dom/selection.hpp"  // for Selection
-#include "ftxui/screen/screen.hpp"  // for Screen
+#include "ftxui/dom/render_pool.hpp"     // for RenderPool
+#include "ftxui/dom/render_profile.hpp"  // for RenderProfile
+#include "ftxui/dom/selection.hpp"       // for Selection
+#include "ftxui/screen/screen.hpp"       // for Screen
 
 namespace ftxui {
 
@@ -23,7 +27,7 @@ void Node::ComputeRequirement() {
     return;
   }
   for (auto& child : children_) {
-    child->ComputeRequirement();
+    child->ComputeRequirementCached();
   }
 
   // By default, the requirement is the one of the first child.
@@ -62,17 +66,151 @@ void Node::Select(Selection& selection) {
 /// @ingroup dom
 void Node::Render(Screen& screen) {
   for (auto& child : children_) {
+    // A child scrolled out of the stencil, e.g. by a frame, draws nothing.
+    if (Box::Intersection(child->box_, screen.stencil).IsEmpty()) {
+      child->RenderHidden(screen);
+      continue;
+    }
     child->Render(screen);
   }
 }
 
-void Node::Check(Status* status) {
+/// @brief Skip an element laid out outside of the stencil.
+/// @ingroup dom
+void Node::RenderHidden(Screen& screen) {
+  // A cached subtree contains no element reporting its box, like reflect().
+  if (requirement_cached_) {
+    return;
+  }
   for (auto& child : children_) {
-    child->Check(status);
+    child->RenderHidden(screen);
+  }
+}
+
+/// @brief Same as Render(), for containers whose children don't overlap.
+/// @details With a RenderPool in scope, the children are split into chunks of
+/// similar area, rendered concurrently into forks of the screen. Children only
+/// partially visible are rendered afterward, on this thread, since they may
+/// draw outside of the stencil.
+/// @ingroup dom
+void Node::RenderDisjoint(Screen& screen) {
+  // Below this area, a chunk costs more to dispatch than to draw.
+  const int kMinChunkArea = 512;
+
+  RenderPool* pool = RenderPool::Current();
+  if (!pool || pool->threads() == 1 || children_.size() < 2) {
+    Node::Render(screen);
+    return;
+  }
+
+  std::vector<Node*> visible;
+  std::vector<Node*> clipped;
+  int area = 0;
+  for (auto& child : children_) {
+    const Box box = Box::Intersection(child->box_, screen.stencil);
+    if (box.IsEmpty()) {
+      child->RenderHidden(screen);
+      continue;
+    }
+    if (box == child->box_) {
+      visible.push_back(child.get());
+      area += (box.x_max - box.x_min + 1) * (box.y_max - box.y_min + 1);
+    } else {
+      clipped.push_back(child.get());
+    }
+  }
+
+  // Split the visible children into chunks: [chunks[i], chunks[i+1]).
+  const int chunk_area = std::max(kMinChunkArea, area / (4 * pool->threads()));
+  std::vector<size_t> chunks;
+  int chunk = 0;
+  for (size_t i = 0; i < visible.size(); ++i) {
+    if (chunk == 0) {
+      chunks.push_back(i);
+    }
+    const Box& box = visible[i]->box_;
+    chunk += (box.x_max - box.x_min + 1) * (box.y_max - box.y_min + 1);
+    if (chunk >= chunk_area) {
+      chunk = 0;
+    }
+  }
+  chunks.push_back(visible.size());
+  const int chunk_count = static_cast<int>(chunks.size()) - 1;
+
+  if (chunk_count < 2) {
+    for (Node* child : visible) {
+      child->Render(screen);
+    }
+  } else {
+    std::vector<Screen> forks;
+    forks.reserve(chunk_count);
+    for (int i = 0; i < chunk_count; ++i) {
+      forks.push_back(screen.Fork());
+    }
+    pool->ParallelFor(chunk_count, [&](int i) {
+      Screen& fork = forks[i];
+      for (size_t c = chunks[i]; c < chunks[i + 1]; ++c) {
+        fork.stencil = visible[c]->box_;
+        visible[c]->Render(fork);
+      }
+    });
+    for (int i = 0; i < chunk_count; ++i) {
+      for (size_t c = chunks[i]; c < chunks[i + 1]; ++c) {
+        screen.Join(forks[i], visible[c]->box_);
+      }
+    }
+  }
+
+  for (Node* child : clipped) {
+    child->Render(screen);
+  }
+}
+
+void Node::Check(Status* status) {
+  // A cached subtree has nothing left to iterate on.
+  if (!requirement_cached_) {
+    for (auto& child : children_) {
+      child->Check(status);
+    }
   }
   status->need_iteration |= (status->iteration == 0);
 }
 
+/// @brief Same as ComputeRequirement(), but skipped when the requirement of
+/// this element can't have changed since the last call.
+/// @ingroup dom
+void Node::ComputeRequirementCached() {
+  if (requirement_cached_) {
+    return;
+  }
+
+  if (RenderProfile* profile = RenderProfile::Current()) {
+    profile->nodes_laid_out++;
+  }
+  ComputeRequirement();
+
+  // The requirement is final when every element of the subtree is cacheable.
+  // Children computed through ComputeRequirement() directly never are.
+  bool cacheable = layout_cacheable_;
+  for (auto& child : children_) {
+    cacheable = cacheable && child->requirement_cached_;
+  }
+  requirement_cached_ = cacheable;
+}
+
+/// @brief Same as SetBox(), but skipped when the subtree was already laid out
+/// in |box|, and its requirement is final.
+/// @ingroup dom
+void Node::SetBoxCached(Box box) {
+  if (box_cached_ && box == cached_box_) {
+    return;
+  }
+
+  SetBox(box);
+  cached_box_ = box;
+  box_cached_ = requirement_cached_;
+}
+
 std::string Node::GetSelectedContent(Selection& selection) {
   std::string content;
 
@@ -98,6 +236,18 @@ void Render(Screen& screen, Node* node) {
 }
 
 void Render(Screen& screen, Node* node, Selection& selection) {
+  // Add the time elapsed since the previous step to the profile, if any.
+  RenderProfile* profile = RenderProfile::Current();
+  auto step_start = profile ? RenderProfile::Clock::now()
+                            : RenderProfile::Clock::time_point();
+  const auto step = [&](RenderProfile::Duration RenderProfile::*duration) {
+    if (profile) {
+      const auto now = RenderProfile::Clock::now();
+      profile->*duration += now - step_start;
+      step_start = now;
+    }
+  };
+
   Box box;
   box.x_min = 0;
   box.y_min = 0;
@@ -109,16 +259,17 @@ void Render(Screen& screen, Node* node, Selection& selection) {
   const int max_iterations = 20;
   while (status.need_iteration && status.iteration < max_iterations) {
     // Step 1: Find what dimension this elements wants to be.
-    node->ComputeRequirement();
+    node->ComputeRequirementCached();
 
     // Step 2: Assign a dimension to the element.
-    node->SetBox(box);
+    node->SetBoxCached(box);
 
     // Check if the element needs another iteration of the layout algorithm.
     status.need_iteration = false;
     status.iteration++;
     node->Check(&status);
   }
+  step(&RenderProfile::layout);
 
   // Step 3: Selection
   if (!selection.IsEmpty()) {
@@ -161,12 +312,31 @@ void Render(Screen& screen, Node* node, Selection& selection) {
     });
   }
 
+  step(&RenderProfile::select);
+
   // Step 4: Draw the element.
   screen.stencil = box;
   node->Render(screen);
+  step(&RenderProfile::render);
 
   // Step 5: Apply shaders
   screen.ApplyShader();
+  step(&RenderProfile::shader);
+
+  if (profile) {
+    profile->layout_iterations += status.iteration;
+
+    // Counting the elements isn't part of any step.
+    std::vector<Node*> nodes = {node};
+    while (!nodes.empty()) {
+      Node* current = nodes.back();
+      nodes.pop_back();
+      profile->nodes++;
+      for (auto& child : current->children_) {
+        nodes.push_back(child.get());
+      }
+    }
+  }
 }
 
 std::string GetNodeSelectedContent(Screen& screen,
@@ -183,10 +353,10 @@ std::string GetNodeSelectedContent(Screen& screen,
   const int max_iterations = 20;
   while (status.need_iteration && status.iteration < max_iterations) {
     // Step 1: Find what dimension this elements wants to be.
-    node->ComputeRequirement();
+    node->ComputeRequirementCached();
 
     // Step 2: Assign a dimension to the element.
-    node->SetBox(box);
+    node->SetBoxCached(box);
 
     // Check if the element needs another iteration of the layout algorithm.
     status.need_iteration = false;
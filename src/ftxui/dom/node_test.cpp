@@ -0,0 +1,100 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <memory>  // for make_shared
+#include <string>  // for allocator
+
+#include "ftxui/dom/elements.hpp"   // for text, vbox, hbox, flexbox, Element
+#include "ftxui/dom/node.hpp"       // for Node, Render
+#include "ftxui/screen/box.hpp"     // for Box
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+// A leaf counting how many times it is laid out.
+class Counter : public Node {
+ public:
+  void ComputeRequirement() override {
+    requirement_.min_x = 3;
+    requirement_.min_y = 1;
+    requirement_.flex_grow_x = 1;
+    ++requirement_count;
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+    ++box_count;
+  }
+
+  int requirement_count = 0;
+  int box_count = 0;
+};
+
+}  // namespace
+
+TEST(NodeTest, LayoutCacheStaticTree) {
+  auto counter = std::make_shared<Counter>();
+  auto root = vbox({
+      text("title"),
+      hbox({counter, text("!")}),
+  });
+
+  Screen screen(10, 3);
+  Render(screen, root);
+  EXPECT_EQ(counter->requirement_count, 1);
+  EXPECT_EQ(counter->box_count, 1);
+
+  // Nothing changed, the layout is reused.
+  Render(screen, root);
+  EXPECT_EQ(counter->requirement_count, 1);
+  EXPECT_EQ(counter->box_count, 1);
+
+  // A different box only lays the tree out again.
+  Screen wider(20, 3);
+  Render(wider, root);
+  EXPECT_EQ(counter->requirement_count, 1);
+  EXPECT_EQ(counter->box_count, 2);
+  EXPECT_EQ(wider.ToString(),
+            "title               \r\n"
+            "                   !\r\n"
+            "                    ");
+}
+
+TEST(NodeTest, LayoutCacheSharedSubtree) {
+  auto counter = std::make_shared<Counter>();
+  auto first = vbox({text("first"), counter});
+  auto second = vbox({text("second"), counter});
+
+  Screen screen(10, 2);
+  Render(screen, first);
+  Render(screen, second);
+  Render(screen, second);
+
+  // The requirement of the shared subtree is computed once. It gets the same
+  // box in both trees, so it is laid out once too.
+  EXPECT_EQ(counter->requirement_count, 1);
+  EXPECT_EQ(counter->box_count, 1);
+}
+
+TEST(NodeTest, LayoutCacheFlexbox) {
+  auto counter = std::make_shared<Counter>();
+  auto root = flexbox({text("aaa"), text("bbb"), counter});
+
+  // Flexbox needs several iterations, and isn't cached. Its children are.
+  Screen screen(6, 2);
+  Render(screen, root);
+  const std::string first = screen.ToString();
+  EXPECT_EQ(counter->requirement_count, 1);
+
+  Screen again(6, 2);
+  Render(again, root);
+  EXPECT_EQ(again.ToString(), first);
+  EXPECT_EQ(counter->requirement_count, 1);
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -1,10 +1,11 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <memory>   // for make_shared, __shared_ptr_access
+#include <memory>   // for __shared_ptr_access
 #include <utility>  // for move
 
 #include "ftxui/dom/elements.hpp"     // for Element, unpack, Decorator, reflect
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
 #include "ftxui/dom/node.hpp"         // for Node, Elements
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
@@ -17,7 +18,10 @@ namespace {
 class Reflect : public Node {
  public:
   Reflect(Element child, Box& box)
-      : Node(unpack(std::move(child))), reflected_box_(box) {}
+      : Node(unpack(std::move(child))), reflected_box_(box) {
+    // The reflected box must be written on every frame.
+    layout_cacheable_ = false;
+  }
 
   void ComputeRequirement() final {
     Node::ComputeRequirement();
@@ -27,7 +31,7 @@ class Reflect : public Node {
   void SetBox(Box box) final {
     reflected_box_ = box;
     Node::SetBox(box);
-    children_[0]->SetBox(box);
+    children_[0]->SetBoxCached(box);
   }
 
   void Render(Screen& screen) final {
@@ -35,6 +39,11 @@ class Reflect : public Node {
     Node::Render(screen);
   }
 
+  void RenderHidden(Screen& screen) final {
+    reflected_box_ = Box::Intersection(screen.stencil, reflected_box_);
+    Node::RenderHidden(screen);
+  }
+
  private:
   Box& reflected_box_;
 };
@@ -42,7 +51,7 @@ class Reflect : public Node {
 
 Decorator reflect(Box& box) {
   return [&](Element child) -> Element {
-    return std::make_shared<Reflect>(std::move(child), box);
+    return MakeNode<Reflect>(std::move(child), box);
   };
 }
 
@@ -0,0 +1,167 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/dom/render_pool.hpp"
+
+#include <algorithm>  // for max
+#include <atomic>     // for atomic, memory_order_acquire, memory_order_release
+#include <deque>      // for deque
+#include <memory>     // for make_unique
+#include <mutex>      // for mutex, lock_guard, unique_lock
+#include <thread>     // for thread, yield
+
+namespace ftxui {
+
+namespace {
+
+thread_local RenderPool* g_current = nullptr;  // NOLINT
+
+// The pool the current thread works for, and the index of its queue.
+thread_local RenderPool* g_worker_pool = nullptr;  // NOLINT
+thread_local int g_worker_queue = 0;               // NOLINT
+
+}  // namespace
+
+struct RenderPool::Batch {
+  void (*run)(void*, int);
+  void* context;
+  std::atomic<int> remaining;
+};
+
+struct alignas(64) RenderPool::Queue {
+  std::mutex mutex;
+  std::deque<Task> tasks;
+};
+
+/// @brief Start |threads - 1| threads. The thread rendering is the last one.
+RenderPool::RenderPool(int threads) {
+  threads = std::max(threads, 1);
+  for (int i = 0; i < threads; ++i) {
+    queues_.push_back(std::make_unique<Queue>());
+  }
+  // The queue 0 is the one of the thread rendering.
+  for (int i = 1; i < threads; ++i) {
+    workers_.emplace_back([this, i] { Work(i); });
+  }
+}
+
+RenderPool::~RenderPool() {
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  wake_up_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+RenderPool::Scope::Scope(RenderPool* pool) : previous_(g_current) {
+  g_current = pool;
+}
+
+RenderPool::Scope::~Scope() {
+  g_current = previous_;
+}
+
+/// @brief The pool of the current thread, or nullptr.
+RenderPool* RenderPool::Current() {
+  return g_current;
+}
+
+void RenderPool::Run(int count, void (*run)(void*, int), void* context) {
+  if (count <= 0) {
+    return;
+  }
+  if (count == 1 || threads() == 1) {
+    for (int i = 0; i < count; ++i) {
+      run(context, i);
+    }
+    return;
+  }
+
+  Batch batch{run, context, {count}};
+
+  // Queue every task but the first one, executed right away. The other
+  // threads steal from the front of the queue, this thread pops from its back.
+  const int queue = QueueOfThisThread();
+  {
+    const std::lock_guard<std::mutex> lock(queues_[queue]->mutex);
+    for (int i = count - 1; i >= 1; --i) {
+      queues_[queue]->tasks.push_back({&batch, i});
+    }
+  }
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    pending_ += count - 1;
+  }
+  wake_up_.notify_all();
+
+  Execute({&batch, 0});
+
+  // Help with any task while the batch is being completed by others.
+  Task task{};
+  while (batch.remaining.load(std::memory_order_acquire) > 0) {
+    if (Pop(queue, &task)) {
+      Execute(task);
+    } else {
+      std::this_thread::yield();
+    }
+  }
+}
+
+/// @brief Take a task from the back of |queue|, or steal one from the front of
+/// another queue.
+bool RenderPool::Pop(int queue, Task* task) {
+  const int size = threads();
+  for (int i = 0; i < size; ++i) {
+    Queue& q = *queues_[(queue + i) % size];
+    const std::lock_guard<std::mutex> lock(q.mutex);
+    if (q.tasks.empty()) {
+      continue;
+    }
+    if (i == 0) {
+      *task = q.tasks.back();
+      q.tasks.pop_back();
+    } else {
+      *task = q.tasks.front();
+      q.tasks.pop_front();
+    }
+    --pending_;
+    return true;
+  }
+  return false;
+}
+
+void RenderPool::Execute(const Task& task) {
+  Batch* batch = task.batch;
+  batch->run(batch->context, task.index);
+  // The batch may be gone as soon as its last task is done.
+  batch->remaining.fetch_sub(1, std::memory_order_release);
+}
+
+void RenderPool::Work(int queue) {
+  // Tasks rendering containers fan out their children into this pool too.
+  g_current = this;
+  g_worker_pool = this;
+  g_worker_queue = queue;
+
+  Task task{};
+  while (true) {
+    if (Pop(queue, &task)) {
+      Execute(task);
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    wake_up_.wait(lock, [this] { return stop_ || pending_ > 0; });
+    if (stop_) {
+      return;
+    }
+  }
+}
+
+int RenderPool::QueueOfThisThread() const {
+  return g_worker_pool == this ? g_worker_queue : 0;
+}
+
+}  // namespace ftxui
@@ -0,0 +1,94 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <atomic>  // for atomic
+#include <string>  // for to_string, string
+#include <vector>  // for vector
+
+#include "ftxui/dom/elements.hpp"     // for text, hbox, vbox, gridbox, border
+#include "ftxui/dom/node.hpp"         // for Render
+#include "ftxui/dom/render_pool.hpp"  // for RenderPool
+#include "ftxui/screen/screen.hpp"    // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+Element Panel(int index) {
+  Elements lines;
+  for (int i = 0; i < 18; ++i) {
+    lines.push_back(text("👍🏻 " + std::to_string(index * 100 + i)));
+  }
+  return vbox(std::move(lines)) | hyperlink("panel" + std::to_string(index)) |
+         border;
+}
+
+Element Dashboard() {
+  Elements rows;
+  for (int y = 0; y < 3; ++y) {
+    Elements row;
+    for (int x = 0; x < 4; ++x) {
+      row.push_back(Panel(y * 4 + x) | size(WIDTH, EQUAL, 20));
+    }
+    rows.push_back(hbox(std::move(row)));
+  }
+  Elements lines;
+  for (int i = 0; i < 100; ++i) {
+    lines.push_back(text("line " + std::to_string(i)) | border);
+  }
+  rows.push_back(gridbox({
+      {text("a") | border, text("b") | border},
+      {vbox(std::move(lines)) | focusPositionRelative(0.5f, 0.5f) | frame |
+           size(HEIGHT, EQUAL, 10),
+       text("c") | border},
+  }));
+  return vbox(std::move(rows));
+}
+
+}  // namespace
+
+TEST(RenderPoolTest, Scope) {
+  RenderPool pool(2);
+  EXPECT_EQ(RenderPool::Current(), nullptr);
+  {
+    RenderPool::Scope scope(&pool);
+    EXPECT_EQ(RenderPool::Current(), &pool);
+  }
+  EXPECT_EQ(RenderPool::Current(), nullptr);
+}
+
+TEST(RenderPoolTest, ParallelFor) {
+  for (int threads : {1, 2, 4}) {
+    RenderPool pool(threads);
+    EXPECT_EQ(pool.threads(), threads);
+    std::vector<std::atomic<int>> calls(64 * 64);
+    pool.ParallelFor(64, [&](int i) {
+      // Nested batches are stolen by the other threads too.
+      pool.ParallelFor(64, [&](int j) { calls[i * 64 + j]++; });
+    });
+    for (auto& call : calls) {
+      EXPECT_EQ(call, 1);
+    }
+  }
+}
+
+TEST(RenderPoolTest, SameAsSerial) {
+  Screen expected(80, 80);
+  Render(expected, Dashboard());
+
+  for (int threads : {2, 3, 8}) {
+    RenderPool pool(threads);
+    RenderPool::Scope scope(&pool);
+    for (int frame = 0; frame < 3; ++frame) {
+      Screen screen(80, 80);
+      Render(screen, Dashboard());
+      // The output includes the graphemes and the hyperlinks.
+      EXPECT_EQ(screen.ToString(), expected.ToString());
+    }
+  }
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -0,0 +1,25 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/dom/render_profile.hpp"
+
+namespace ftxui {
+
+namespace {
+thread_local RenderProfile* g_current = nullptr;  // NOLINT
+}  // namespace
+
+RenderProfile::Scope::Scope(RenderProfile* profile) : previous_(g_current) {
+  g_current = profile;
+}
+
+RenderProfile::Scope::~Scope() {
+  g_current = previous_;
+}
+
+/// @brief The profile of the current thread, or nullptr.
+RenderProfile* RenderProfile::Current() {
+  return g_current;
+}
+
+}  // namespace ftxui
@@ -0,0 +1,62 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+
+#include "ftxui/dom/elements.hpp"        // for text, hbox, vbox, border
+#include "ftxui/dom/node.hpp"            // for Render
+#include "ftxui/dom/render_profile.hpp"  // for RenderProfile
+#include "ftxui/screen/screen.hpp"       // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(RenderProfileTest, Disabled) {
+  EXPECT_EQ(RenderProfile::Current(), nullptr);
+  Screen screen(5, 1);
+  Render(screen, text("hello"));
+  EXPECT_EQ(RenderProfile::Current(), nullptr);
+}
+
+TEST(RenderProfileTest, Counters) {
+  // 6 elements: vbox, text, border, hbox, text, text.
+  auto element = vbox({
+      text("title"),
+      hbox({text("a"), text("b")}) | border,
+  });
+  Screen screen(10, 4);
+
+  RenderProfile first;
+  {
+    RenderProfile::Scope scope(&first);
+    EXPECT_EQ(RenderProfile::Current(), &first);
+    Render(screen, element);
+  }
+  EXPECT_EQ(RenderProfile::Current(), nullptr);
+  EXPECT_EQ(first.layout_iterations, 1);
+  EXPECT_EQ(first.nodes, 6);
+  EXPECT_EQ(first.nodes_laid_out, 6);
+  EXPECT_GT(first.layout.count() + first.render.count(), 0);
+
+  // The layout of the element kept is reused.
+  RenderProfile second;
+  {
+    RenderProfile::Scope scope(&second);
+    Render(screen, element);
+  }
+  EXPECT_EQ(second.layout_iterations, 1);
+  EXPECT_EQ(second.nodes, 6);
+  EXPECT_EQ(second.nodes_laid_out, 0);
+
+  // Profiles add up.
+  {
+    RenderProfile::Scope scope(&second);
+    Render(screen, text("new"));
+  }
+  EXPECT_EQ(second.layout_iterations, 2);
+  EXPECT_EQ(second.nodes, 7);
+  EXPECT_EQ(second.nodes_laid_out, 1);
+}
+
+}  // namespace ftxui
+// NOLINTEND
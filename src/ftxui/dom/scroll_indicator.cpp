@@ -2,11 +2,12 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include <algorithm>  // for max
-#include <memory>     // for make_shared, __shared_ptr_access
+#include <memory>     // for __shared_ptr_access
 #include <string>     // for string
 #include <utility>    // for move
 
 #include "ftxui/dom/elements.hpp"  // for Element, vscroll_indicator, hscroll_indicator
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
 #include "ftxui/dom/node.hpp"            // for Node, Elements
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
 #include "ftxui/dom/requirement.hpp"     // for Requirement
@@ -31,7 +32,7 @@ Element vscroll_indicator(Element child) {
     void SetBox(Box box) override {
       box_ = box;
       box.x_max--;
-      children_[0]->SetBox(box);
+      children_[0]->SetBoxCached(box);
     }
 
     void Render(Screen& screen) final {
@@ -66,7 +67,7 @@ Element vscroll_indicator(Element child) {
       }
     }
   };
-  return std::make_shared<Impl>(std::move(child));
+  return MakeNode<Impl>(std::move(child));
 }
 
 /// @brief Display an horizontal scrollbar to the bottom.
@@ -85,7 +86,7 @@ Element hscroll_indicator(Element child) {
     void SetBox(Box box) override {
       box_ = box;
       box.y_max--;
-      children_[0]->SetBox(box);
+      children_[0]->SetBoxCached(box);
     }
 
     void Render(Screen& screen) final {
@@ -120,7 +121,7 @@ Element hscroll_indicator(Element child) {
       }
     }
   };
-  return std::make_shared<Impl>(std::move(child));
+  return MakeNode<Impl>(std::move(child));
 }
 
 }  // namespace ftxui
@@ -2,10 +2,11 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include <functional>  // for function
-#include <memory>      // for make_shared
+#include <memory>      // for shared_ptr
 #include <utility>     // for move
 
 #include "ftxui/dom/elements.hpp"  // for Element, Decorator, bgcolor, color
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
 #include "ftxui/screen/color.hpp"        // for Color
 #include "ftxui/screen/pixel.hpp"        // for Pixel
@@ -53,7 +54,7 @@ class SelectionStyle : public NodeDecorator {
 /// @param child The input element.
 /// @return The output element with the selection style reset.
 Element selectionStyleReset(Element child) {
-  return std::make_shared<SelectionStyleReset>(std::move(child));
+  return MakeNode<SelectionStyleReset>(std::move(child));
 }
 
 /// @brief Set the background color of an element when selected.
@@ -85,7 +86,7 @@ Decorator selectionColor(Color foreground) {
 // NOLINTNEXTLINE
 Decorator selectionStyle(std::function<void(Pixel&)> style) {
   return [style](Element child) -> Element {
-    return std::make_shared<SelectionStyle>(std::move(child), style);
+    return MakeNode<SelectionStyle>(std::move(child), style);
   };
 }
 
@@ -167,8 +167,8 @@ TEST(SelectionTest, VBoxSelection) {
 
   EXPECT_EQ(selection.GetParts(), "rem ipsum dolor\nUt ");
   EXPECT_EQ(screen.ToString(),
-            "Lo\x1B[7mrem ipsum dolor\x1B[27m   \r\n"
-            "\x1B[7mUt \x1B[27menim ad minim    ");
+            "Lo\x1B[7mrem ipsum dolor\x1B[0m   \r\n"
+            "\x1B[7mUt \x1B[0menim ad minim    ");
 }
 
 TEST(SelectionTest, VBoxSaturatedSelection) {
@@ -184,9 +184,9 @@ TEST(SelectionTest, VBoxSaturatedSelection) {
   EXPECT_EQ(selection.GetParts(), "rem ipsum dolor\nUt enim ad minim\nDui");
 
   EXPECT_EQ(screen.ToString(),
-            "Lo\x1B[7mrem ipsum dolor\x1B[27m   \r\n"
-            "\x1B[7mUt enim ad minim\x1B[27m    \r\n"
-            "\x1B[7mDui\x1B[27ms aute irure     ");
+            "Lo\x1B[7mrem ipsum dolor\x1B[0m   \r\n"
+            "\x1B[7mUt enim ad minim\x1B[0m    \r\n"
+            "\x1B[7mDui\x1B[0ms aute irure     ");
 }
 
 TEST(SelectionTest, HBoxSelection) {
@@ -200,7 +200,7 @@ TEST(SelectionTest, HBoxSelection) {
   Render(screen, element.get(), selection);
   EXPECT_EQ(selection.GetParts(), "rem ipsum dolorUt e");
   EXPECT_EQ(screen.ToString(),
-            "Lo\x1B[7mrem ipsum dolorUt e\x1B[27mnim ad minim       ");
+            "Lo\x1B[7mrem ipsum dolorUt e\x1B[0mnim ad minim       ");
 }
 
 TEST(SelectionTest, HBoxSaturatedSelection) {
@@ -216,7 +216,7 @@ TEST(SelectionTest, HBoxSaturatedSelection) {
   Render(screen, element.get(), selection);
   EXPECT_EQ(selection.GetParts(), "rem ipsum dolorUt enim ad minimDui");
   EXPECT_EQ(screen.ToString(),
-            "Lo\x1B[7mrem ipsum dolorUt enim ad minimDui\x1B[27ms aute irure   "
+            "Lo\x1B[7mrem ipsum dolorUt enim ad minimDui\x1B[0ms aute irure   "
             "         ");
 }
 
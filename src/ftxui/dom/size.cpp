@@ -2,10 +2,11 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include <algorithm>  // for min, max
-#include <memory>     // for make_shared, __shared_ptr_access
+#include <memory>     // for __shared_ptr_access
 #include <utility>    // for move
 
 #include "ftxui/dom/elements.hpp"  // for Constraint, WidthOrHeight, EQUAL, GREATER_THAN, LESS_THAN, WIDTH, unpack, Decorator, Element, size
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
 #include "ftxui/dom/node.hpp"      // for Node, Elements
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
@@ -70,7 +71,7 @@ class Size : public Node {
           break;
       }
     }
-    children_[0]->SetBox(box);
+    children_[0]->SetBoxCached(box);
   }
 
  private:
@@ -88,7 +89,7 @@ class Size : public Node {
 /// @ingroup dom
 Decorator size(WidthOrHeight direction, Constraint constraint, int value) {
   return [=](Element e) {
-    return std::make_shared<Size>(std::move(e), direction, constraint, value);
+    return MakeNode<Size>(std::move(e), direction, constraint, value);
   };
 }
 
@@ -2,31 +2,51 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include <algorithm>  // for min
-#include <memory>     // for make_shared
-#include <sstream>
-#include <string>   // for string, wstring
-#include <utility>  // for move
+#include <memory>     // for shared_ptr
+#include <string>     // for string, wstring
+#include <utility>    // for move
+#include <vector>     // for vector
 
 #include "ftxui/dom/deprecated.hpp"   // for text, vtext
 #include "ftxui/dom/elements.hpp"     // for Element, text, vtext
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
 #include "ftxui/dom/node.hpp"         // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/dom/selection.hpp"    // for Selection
 #include "ftxui/screen/box.hpp"       // for Box
 #include "ftxui/screen/screen.hpp"    // for Pixel, Screen
-#include "ftxui/screen/string.hpp"  // for string_width, Utf8ToGlyphs, to_string
+#include "ftxui/screen/string.hpp"  // for Utf8ToGlyphSpans, Utf8ToGlyphs, to_string
 
 namespace ftxui {
 
 namespace {
 using ftxui::Screen;
 
+// Split |text| into one span per cell.
+std::vector<GlyphSpan> Segment(std::string& text) {
+  bool complete = true;
+  std::vector<GlyphSpan> cells = Utf8ToGlyphSpans(text, &complete);
+  if (complete) {
+    return cells;
+  }
+
+  // Rare: a combining character follows an ignored control character. Drop the
+  // ignored bytes, so that it can modify the previous glyph, like with
+  // Utf8ToGlyphs.
+  std::string glyphs;
+  for (const std::string& glyph : Utf8ToGlyphs(text)) {
+    glyphs += glyph;
+  }
+  text = std::move(glyphs);
+  return Utf8ToGlyphSpans(text);
+}
+
 class Text : public Node {
  public:
   explicit Text(std::string text) : text_(std::move(text)) {}
 
   void ComputeRequirement() override {
-    requirement_.min_x = string_width(text_);
+    requirement_.min_x = static_cast<int>(Cells().size());
     requirement_.min_y = 1;
     has_selection = false;
   }
@@ -40,34 +60,44 @@ class Text : public Node {
     selection_start_ = selection_saturated.GetBox().x_min;
     selection_end_ = selection_saturated.GetBox().x_max;
 
-    std::stringstream ss;
+    std::string selected;
     int x = box_.x_min;
-    for (const auto& cell : Utf8ToGlyphs(text_)) {
+    for (const GlyphSpan& span : Cells()) {
+      const std::string_view cell = span.In(text_);
       if (cell == "\n")
         continue;
 
       if (selection_start_ <= x && x <= selection_end_)
-        ss << cell;
+        selected += cell;
 
       x++;
     }
-    selection.AddPart(ss.str(), box_.y_min, selection_start_, selection_end_);
+    selection.AddPart(selected, box_.y_min, selection_start_, selection_end_);
   }
 
   void Render(Screen& screen) override {
     int x = box_.x_min;
     const int y = box_.y_min;
+    const int x_max = std::min(box_.x_max, screen.stencil.x_max);
 
-    if (y > box_.y_max)
+    // Rows scrolled out of a frame are not drawn.
+    if (y > box_.y_max || y < screen.stencil.y_min ||
+        y > screen.stencil.y_max)
       return;
 
-    for (const auto& cell : Utf8ToGlyphs(text_)) {
-      if (x > box_.x_max)
+    for (const GlyphSpan& span : Cells()) {
+      if (x > x_max)
         break;
 
+      const std::string_view cell = span.In(text_);
       if (cell == "\n")
         continue;
 
+      if (x < screen.stencil.x_min) {
+        ++x;
+        continue;
+      }
+
       screen.PixelAt(x, y).grapheme.copy(cell, screen.get_pool());
 
       if (has_selection) {
@@ -82,7 +112,19 @@ class Text : public Node {
   }
 
  private:
+  // Segment the text once, when its requirement is first computed. Its width
+  // is the number of cells.
+  const std::vector<GlyphSpan>& Cells() {
+    if (!segmented_) {
+      cells_ = Segment(text_);
+      segmented_ = true;
+    }
+    return cells_;
+  }
+
   std::string text_;
+  std::vector<GlyphSpan> cells_;  // One span per cell.
+  bool segmented_ = false;
   bool has_selection = false;
   int selection_start_ = 0;
   int selection_end_ = -1;
@@ -90,12 +132,18 @@ class Text : public Node {
 
 class VText : public Node {
  public:
-  explicit VText(std::string text)
-      : text_(std::move(text)), width_{std::min(string_width(text_), 1)} {}
+  explicit VText(std::string text) : text_(std::move(text)) {}
 
   void ComputeRequirement() override {
+    // Segment the text once. Its height is the number of cells.
+    if (!segmented_) {
+      cells_ = Segment(text_);
+      segmented_ = true;
+    }
+    const int height = static_cast<int>(cells_.size());
+    width_ = std::min(height, 1);
     requirement_.min_x = width_;
-    requirement_.min_y = string_width(text_);
+    requirement_.min_y = height;
   }
 
   void Render(Screen& screen) override {
@@ -104,17 +152,25 @@ class VText : public Node {
     if (x + width_ - 1 > box_.x_max)
       return;
 
-    for (const auto& it : Utf8ToGlyphs(text_)) {
-      if (y > box_.y_max)
+    if (x < screen.stencil.x_min || x > screen.stencil.x_max)
+      return;
+
+    const int y_max = std::min(box_.y_max, screen.stencil.y_max);
+    for (const GlyphSpan& span : cells_) {
+      if (y > y_max)
         return;
 
-      screen.PixelAt(x, y).grapheme.copy(it, screen.get_pool());
+      if (y >= screen.stencil.y_min) {
+        screen.PixelAt(x, y).grapheme.copy(span.In(text_), screen.get_pool());
+      }
       y += 1;
     }
   }
 
  private:
   std::string text_;
+  std::vector<GlyphSpan> cells_;  // One span per cell.
+  bool segmented_ = false;
   int width_ = 1;
 };
 
@@ -136,7 +192,7 @@ class VText : public Node {
 /// Hello world!
 /// ```
 Element text(std::string text) {
-  return std::make_shared<Text>(std::move(text));
+  return MakeNode<Text>(std::move(text));
 }
 
 /// @brief Display a piece of unicode text.
@@ -155,7 +211,7 @@ Element text(std::string text) {
 /// Hello world!
 /// ```
 Element text(std::wstring text) {  // NOLINT
-  return std::make_shared<Text>(to_string(text));
+  return MakeNode<Text>(to_string(text));
 }
 
 /// @brief Display a piece of unicode text vertically.
@@ -185,7 +241,7 @@ Element text(std::wstring text) {  // NOLINT
 /// !
 /// ```
 Element vtext(std::string text) {
-  return std::make_shared<VText>(std::move(text));
+  return MakeNode<VText>(std::move(text));
 }
 
 /// @brief Display a piece unicode text vertically.
@@ -215,7 +271,7 @@ Element vtext(std::string text) {
 /// !
 /// ```
 Element vtext(std::wstring text) {  // NOLINT
-  return std::make_shared<VText>(to_string(text));
+  return MakeNode<VText>(to_string(text));
 }
 
 }  // namespace ftxui
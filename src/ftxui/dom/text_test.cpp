@@ -121,5 +121,28 @@ TEST(TextTest, CombiningCharactersWithSpace) {
   EXPECT_EQ(t, screen.ToString());
 }
 
+TEST(TextTest, CombiningCharactersAfterControl) {
+  // The ignored control character doesn't separate the combining character
+  // from the glyph it modifies.
+  {
+    auto element = text("a\t\u0301b");
+    Screen screen(3, 1);
+    Render(screen, element);
+    EXPECT_EQ("a\u0301b ", screen.ToString());
+  }
+  {
+    auto element = text("x\r\uFE0F");
+    Screen screen(2, 1);
+    Render(screen, element);
+    EXPECT_EQ("x\uFE0F ", screen.ToString());
+  }
+  {
+    auto element = vtext("a\t\u0301b");
+    Screen screen(1, 2);
+    Render(screen, element);
+    EXPECT_EQ("a\u0301\r\nb", screen.ToString());
+  }
+}
+
 }  // namespace ftxui
 // NOLINTEND
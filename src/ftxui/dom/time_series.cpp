@@ -0,0 +1,344 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/dom/time_series.hpp"
+
+#include <algorithm>    // for min, max, fill
+#include <cstdint>      // for uint8_t, uint32_t, uint64_t, int32_t
+#include <cstring>      // for memcpy
+#include <memory>       // for shared_ptr, make_unique
+#include <mutex>        // for lock_guard
+#include <string_view>  // for string_view
+#include <utility>      // for move
+#include <vector>       // for vector
+
+#include "ftxui/dom/elements.hpp"     // for Element, timeSeries
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
+#include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"    // for Screen
+
+namespace ftxui {
+
+namespace {
+
+uint64_t Pack(float value, uint64_t index) {
+  uint32_t bits = 0;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return (uint64_t(bits) << 32) | uint32_t(index + 1);  // NOLINT
+}
+
+float Unpack(uint64_t slot) {
+  const auto bits = uint32_t(slot >> 32);  // NOLINT
+  float value = 0.f;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+// The same characters as graph().
+// NOLINTNEXTLINE
+constexpr std::string_view charset[] =
+#if defined(FTXUI_MICROSOFT_TERMINAL_FALLBACK)
+    {" ", " ", "█", " ", "█", "█", "█", "█", "█"};
+#else
+    {" ", "▗", "▐", "▖", "▄", "▟", "▌", "▙", "█"};
+#endif
+
+// The bits of the braille dots, in the order of their code points, from the
+// top.
+// NOLINTNEXTLINE
+constexpr uint8_t braille[2][4] = {
+    {0b00000001, 0b00000010, 0b00000100, 0b01000000},  // NOLINT
+    {0b00001000, 0b00010000, 0b00100000, 0b10000000},  // NOLINT
+};
+
+class TimeSeriesNode : public Node {
+ public:
+  TimeSeriesNode(std::shared_ptr<TimeSeries> series, TimeSeriesConfig config)
+      : series_(std::move(series)), config_(config) {}
+
+  void ComputeRequirement() override {
+    requirement_.flex_grow_x = 1;
+    requirement_.flex_grow_y = 1;
+    requirement_.flex_shrink_x = 1;
+    requirement_.flex_shrink_y = 1;
+    requirement_.min_x = 3;
+    requirement_.min_y = 3;
+  }
+
+  void Render(Screen& screen) override {
+    const int width = box_.x_max - box_.x_min + 1;
+    const int height = box_.y_max - box_.y_min + 1;
+    if (width <= 0 || height <= 0) {
+      return;
+    }
+
+    // Two columns per cell, in both styles.
+    series_->Downsample(width * 2, config_.window, columns_);
+
+    float min = config_.min;
+    float max = config_.max;
+    if (min >= max) {
+      bool empty = true;
+      for (const auto& column : columns_) {
+        if (column.count == 0) {
+          continue;
+        }
+        min = empty ? column.min : std::min(min, column.min);
+        max = empty ? column.max : std::max(max, column.max);
+        empty = false;
+      }
+      if (empty) {
+        return;
+      }
+      if (min >= max) {
+        min -= 1.f;
+        max += 1.f;
+      }
+    }
+
+    if (config_.style == TimeSeriesConfig::Style::Block) {
+      RenderBlock(screen, height, min, max);
+    } else {
+      RenderBraille(screen, width, height, min, max);
+    }
+  }
+
+ private:
+  // The value |v| scaled to [0, levels], from the bottom.
+  static int Level(float v, float min, float max, int levels) {
+    const float level = (v - min) / (max - min) * float(levels);
+    if (!(level > 0.f)) {  // Also NaN.
+      return 0;
+    }
+    return level < float(levels) ? int(level + 0.5f) : levels;
+  }
+
+  // Like graph(): the average of each column, as an area.
+  void RenderBlock(Screen& screen, int height, float min, float max) {
+    int i = 0;
+    for (int x = box_.x_min; x <= box_.x_max; ++x) {
+      const auto level = [&](const TimeSeries::Column& column) {
+        // An empty column is below the bottom, and draws nothing.
+        return column.count ? Level(column.avg, min, max, 2 * height) : -1;
+      };
+      const int height_1 = 2 * box_.y_max - level(columns_[i++]);
+      const int height_2 = 2 * box_.y_max - level(columns_[i++]);
+      for (int y = box_.y_min; y <= box_.y_max; ++y) {
+        const int yy = 2 * y;
+        int i_1 = yy < height_1 ? 0 : yy == height_1 ? 3 : 6;  // NOLINT
+        int i_2 = yy < height_2 ? 0 : yy == height_2 ? 1 : 2;  // NOLINT
+        screen.PixelAt(x, y).grapheme = charset[i_1 + i_2];    // NOLINT
+      }
+    }
+  }
+
+  // The range of each column, joined to the previous one, with braille dots.
+  void RenderBraille(Screen& screen,
+                     int width,
+                     int height,
+                     float min,
+                     float max) {
+    const int rows = 4 * height;
+    dots_.assign(size_t(width) * size_t(height), 0);
+    int previous_low = 0;
+    int previous_high = 0;
+    bool previous = false;
+    for (int x = 0; x < 2 * width; ++x) {
+      const TimeSeries::Column& column = columns_[x];
+      if (column.count == 0) {
+        previous = false;
+        continue;
+      }
+      const int low = Level(column.min, min, max, rows - 1);
+      const int high = Level(column.max, min, max, rows - 1);
+      // The rows of dots, from the top, joined to the previous column.
+      const int top =
+          rows - 1 - (previous ? std::max(high, previous_low) : high);
+      const int bottom =
+          rows - 1 - (previous ? std::min(low, previous_high) : low);
+      previous_low = low;
+      previous_high = high;
+      previous = true;
+
+      // Set the dots a cell at a time: the cells between the first and the
+      // last one are full.
+      const uint8_t* bits = braille[x % 2];
+      uint8_t* cell = dots_.data() + x / 2;
+      const auto range = [&](int from, int to) {
+        uint8_t mask = 0;
+        for (int r = from; r <= to; ++r) {
+          mask |= bits[r];
+        }
+        return mask;
+      };
+      const int top_cell = top / 4;
+      const int bottom_cell = bottom / 4;
+      if (top_cell == bottom_cell) {
+        cell[top_cell * width] |= range(top % 4, bottom % 4);
+        continue;
+      }
+      const uint8_t full = range(0, 3);
+      cell[top_cell * width] |= range(top % 4, 3);
+      for (int y = top_cell + 1; y < bottom_cell; ++y) {
+        cell[y * width] |= full;
+      }
+      cell[bottom_cell * width] |= range(0, bottom % 4);
+    }
+
+    for (int y = 0; y < height; ++y) {
+      for (int x = 0; x < width; ++x) {
+        const uint8_t dots = dots_[x + y * width];
+        if (dots == 0) {
+          continue;
+        }
+        const char utf8[3] = {
+            char(0xE2),                 // NOLINT
+            char(0xA0 | (dots >> 6)),   // NOLINT
+            char(0x80 | (dots & 0x3F)),  // NOLINT
+        };
+        screen.PixelAt(box_.x_min + x, box_.y_min + y).grapheme =
+            std::string_view(utf8, 3);
+      }
+    }
+  }
+
+  std::shared_ptr<TimeSeries> series_;
+  TimeSeriesConfig config_;
+  std::vector<TimeSeries::Column> columns_;
+  std::vector<uint8_t> dots_;
+};
+
+}  // namespace
+
+/// @brief Keep the last |capacity| samples pushed.
+TimeSeries::TimeSeries(size_t capacity)
+    : capacity_(std::max(capacity, size_t(1))),
+      slots_(std::make_unique<Slot[]>(capacity_)) {}
+
+TimeSeries::~TimeSeries() = default;
+
+/// @brief Append a sample, replacing the oldest one once full.
+/// @note Thread safe. This doesn't lock and doesn't allocate, so that producer
+/// threads can push samples at a high rate.
+void TimeSeries::Push(float value) {
+  const uint64_t index = pushed_.fetch_add(1, std::memory_order_relaxed);
+  slots_[index % capacity_].value_and_index.store(Pack(value, index),
+                                                  std::memory_order_release);
+}
+
+/// @brief The number of samples kept.
+size_t TimeSeries::size() const {
+  return size_t(std::min<uint64_t>(pushed(), capacity_));
+}
+
+/// @brief Aggregate the last samples into columns of consecutive samples.
+/// @param columns the number of columns.
+/// @param window how many of the last samples to aggregate. 0 for all those
+/// kept.
+/// @param out the columns, from the oldest to the newest. The columns before
+/// the first sample are empty.
+///
+/// The columns complete are kept, and reused by the next calls with the same
+/// number of columns and window: only the newest ones are aggregated again.
+void TimeSeries::Downsample(int columns,
+                            size_t window,
+                            std::vector<Column>& out) {
+  out.assign(size_t(std::max(columns, 0)), Column());
+  if (columns <= 0) {
+    return;
+  }
+  if (window == 0 || window > capacity_) {
+    window = capacity_;
+  }
+  const uint64_t bucket_size =
+      std::max<uint64_t>(1, (window + size_t(columns) - 1) / size_t(columns));
+
+  const std::lock_guard<std::mutex> lock(mutex_);
+  if (bucket_size != bucket_size_ || buckets_.size() != size_t(columns)) {
+    bucket_size_ = bucket_size;
+    buckets_.assign(size_t(columns), Bucket());
+  }
+
+  const uint64_t head = pushed();
+  if (head == 0) {
+    return;
+  }
+  const uint64_t newest = (head - 1) / bucket_size;
+  for (int i = 0; i < columns; ++i) {
+    const auto age = uint64_t(columns - 1 - i);
+    if (age > newest) {
+      continue;
+    }
+    const uint64_t id = newest - age;
+    Bucket& bucket = buckets_[id % buckets_.size()];
+    if (bucket.id != id || !bucket.complete) {
+      bucket = Aggregate(id, head);
+    }
+    out[i] = bucket.column;
+  }
+}
+
+// Aggregate the samples of the bucket |id|, once |head| samples were pushed.
+TimeSeries::Bucket TimeSeries::Aggregate(uint64_t id, uint64_t head) const {
+  Bucket bucket;
+  bucket.id = id;
+  bucket.complete = (id + 1) * bucket_size_ <= head;
+
+  const uint64_t oldest = head > capacity_ ? head - capacity_ : 0;
+  const uint64_t begin = std::max(id * bucket_size_, oldest);
+  const uint64_t end = std::min((id + 1) * bucket_size_, head);
+  double sum = 0.0;
+  Column& column = bucket.column;
+  for (uint64_t index = begin; index < end; ++index) {
+    const uint64_t slot = slots_[index % capacity_].value_and_index.load(
+        std::memory_order_acquire);
+    const auto age = int32_t(uint32_t(index + 1) - uint32_t(slot));
+    if (age != 0) {
+      // Still being pushed by another thread: retry on the next call. A
+      // sample already replaced by a newer one is lost.
+      if (age > 0) {
+        bucket.complete = false;
+      }
+      continue;
+    }
+    const float value = Unpack(slot);
+    column.min = column.count ? std::min(column.min, value) : value;
+    column.max = column.count ? std::max(column.max, value) : value;
+    sum += value;
+    column.count++;
+  }
+  if (column.count) {
+    column.avg = float(sum / column.count);
+  }
+  return bucket;
+}
+
+/// @brief Draw the last samples of a TimeSeries, as a graph.
+/// @param series the samples, which other threads may push to.
+/// @param config how to draw the samples.
+/// @ingroup dom
+///
+/// Each frame aggregates into columns only the samples pushed since the
+/// previous one, instead of the whole history.
+///
+/// ### Example
+///
+/// ```cpp
+/// auto series = std::make_shared<TimeSeries>(10000);
+/// std::thread producer([&] {
+///   while (true) {
+///     series->Push(ReadSensor());
+///   }
+/// });
+/// auto renderer = Renderer([&] {
+///   return timeSeries(series) | color(Color::Green) | border;
+/// });
+/// ```
+Element timeSeries(std::shared_ptr<TimeSeries> series,
+                   TimeSeriesConfig config) {
+  return MakeNode<TimeSeriesNode>(std::move(series), config);
+}
+
+}  // namespace ftxui
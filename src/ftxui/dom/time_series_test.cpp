@@ -0,0 +1,144 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <memory>  // for make_shared
+#include <thread>  // for thread
+#include <vector>  // for vector
+
+#include "ftxui/dom/elements.hpp"     // for timeSeries
+#include "ftxui/dom/node.hpp"         // for Render
+#include "ftxui/dom/time_series.hpp"  // for TimeSeries, TimeSeriesConfig
+#include "ftxui/screen/screen.hpp"    // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(TimeSeriesTest, Empty) {
+  TimeSeries series(10);
+  EXPECT_EQ(series.size(), 0u);
+  EXPECT_EQ(series.pushed(), 0u);
+
+  std::vector<TimeSeries::Column> columns;
+  series.Downsample(4, 0, columns);
+  ASSERT_EQ(columns.size(), 4u);
+  for (const auto& column : columns) {
+    EXPECT_EQ(column.count, 0);
+  }
+
+  Screen screen(5, 3);
+  Render(screen, timeSeries(std::make_shared<TimeSeries>(10)));
+  EXPECT_EQ(screen.ToString(), "     \r\n     \r\n     ");
+}
+
+TEST(TimeSeriesTest, Downsample) {
+  TimeSeries series(8);
+  for (int i = 0; i < 20; ++i) {
+    series.Push(float(i));
+  }
+  EXPECT_EQ(series.size(), 8u);
+  EXPECT_EQ(series.pushed(), 20u);
+
+  // 8 samples kept, 4 columns of 2 samples: [12, 13] ... [18, 19].
+  std::vector<TimeSeries::Column> columns;
+  series.Downsample(4, 0, columns);
+  ASSERT_EQ(columns.size(), 4u);
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(columns[i].count, 2);
+    EXPECT_EQ(columns[i].min, float(12 + 2 * i));
+    EXPECT_EQ(columns[i].max, float(13 + 2 * i));
+    EXPECT_EQ(columns[i].avg, float(12 + 2 * i) + 0.5f);
+  }
+
+  // The window of the last 4 samples.
+  series.Downsample(2, 4, columns);
+  ASSERT_EQ(columns.size(), 2u);
+  EXPECT_EQ(columns[0].min, 16.f);
+  EXPECT_EQ(columns[1].max, 19.f);
+}
+
+TEST(TimeSeriesTest, Incremental) {
+  // The columns kept from one call to the next match those of a series
+  // aggregated from scratch.
+  TimeSeries series(100);
+  std::vector<TimeSeries::Column> columns;
+  for (int i = 0; i < 500; ++i) {
+    series.Push(float((i * 37) % 101));
+    if (i % 7 == 0) {
+      series.Downsample(10, 0, columns);
+    }
+  }
+  series.Downsample(10, 0, columns);
+
+  TimeSeries fresh(100);
+  for (int i = 0; i < 500; ++i) {
+    fresh.Push(float((i * 37) % 101));
+  }
+  std::vector<TimeSeries::Column> expected;
+  fresh.Downsample(10, 0, expected);
+
+  ASSERT_EQ(columns.size(), expected.size());
+  for (size_t i = 0; i < columns.size(); ++i) {
+    EXPECT_EQ(columns[i].count, expected[i].count);
+    EXPECT_EQ(columns[i].min, expected[i].min);
+    EXPECT_EQ(columns[i].max, expected[i].max);
+    EXPECT_EQ(columns[i].avg, expected[i].avg);
+  }
+}
+
+TEST(TimeSeriesTest, ConcurrentProducers) {
+  TimeSeries series(1000);
+  std::vector<std::thread> producers;
+  for (int t = 0; t < 4; ++t) {
+    producers.emplace_back([&] {
+      for (int i = 0; i < 10000; ++i) {
+        series.Push(1.f);
+      }
+    });
+  }
+  std::vector<TimeSeries::Column> columns;
+  while (series.pushed() < 20000) {
+    series.Downsample(10, 0, columns);
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  EXPECT_EQ(series.pushed(), 40000u);
+
+  series.Downsample(10, 0, columns);
+  int count = 0;
+  for (const auto& column : columns) {
+    EXPECT_EQ(column.min, 1.f);
+    EXPECT_EQ(column.max, 1.f);
+    count += column.count;
+  }
+  EXPECT_EQ(count, 1000);
+}
+
+TEST(TimeSeriesTest, Block) {
+  auto series = std::make_shared<TimeSeries>(6);
+  for (float value : {0.f, 1.f, 2.f, 3.f, 4.f, 4.f}) {
+    series->Push(value);
+  }
+  TimeSeriesConfig config;
+  config.style = TimeSeriesConfig::Style::Block;
+  config.min = 0.f;
+  config.max = 4.f;
+  Screen screen(3, 2);
+  Render(screen, timeSeries(series, config));
+  EXPECT_EQ(screen.ToString(), " ▟█\r\n▟██");
+}
+
+TEST(TimeSeriesTest, Braille) {
+  auto series = std::make_shared<TimeSeries>(6);
+  for (float value : {0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f}) {
+    series->Push(value);
+  }
+  Screen screen(3, 2);
+  Render(screen, timeSeries(series));
+  // The 6 samples kept, from 2 to 7, fit the 8 rows of dots.
+  EXPECT_EQ(screen.ToString(), " ⢀⡞\r\n⣠⠏ ");
+}
+
+}  // namespace ftxui
+// NOLINTEND
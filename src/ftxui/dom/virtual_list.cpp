@@ -0,0 +1,139 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <algorithm>   // for max, min
+#include <functional>  // for function
+#include <limits>      // for numeric_limits
+#include <memory>      // for shared_ptr
+#include <utility>     // for move
+
+#include "ftxui/dom/elements.hpp"     // for Element, virtualList
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
+#include "ftxui/dom/node.hpp"         // for Node, Elements
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/util/autoreset.hpp"   // for AutoReset
+
+namespace ftxui {
+
+namespace {
+
+class VirtualList : public Node {
+ public:
+  VirtualList(int count,
+              int row_height,
+              std::function<Element(int)> row,
+              int focused)
+      : count_(std::max(count, 0)),
+        row_height_(std::max(row_height, 1)),
+        row_(std::move(row)),
+        focused_(focused) {
+    // The rows are built from |row_|, which may return something different
+    // on every call.
+    layout_cacheable_ = false;
+  }
+
+  void ComputeRequirement() override {
+    // Like a frame, the list asks for its whole content, but accepts being
+    // shrunk.
+    const long long height = static_cast<long long>(count_) * row_height_;
+    requirement_ = Requirement{};
+    requirement_.min_y = static_cast<int>(
+        std::min<long long>(height, std::numeric_limits<int>::max() / 2));
+    requirement_.flex_grow_x = 1;
+    requirement_.flex_shrink_x = 1;
+    requirement_.flex_shrink_y = 1;
+
+    if (focused_ >= 0 && focused_ < count_) {
+      requirement_.focused.enabled = true;
+      requirement_.focused.node = this;
+      requirement_.focused.box.y_min = focused_ * row_height_;
+      requirement_.focused.box.y_max = focused_ * row_height_ + row_height_ - 1;
+    }
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+
+    // Scroll to make the focused row visible, the same way yframe does.
+    const int external_dimy = box.y_max - box.y_min;
+    const int internal_dimy = std::max(requirement_.min_y, external_dimy);
+    const auto& focused_box = requirement_.focused.box;
+    const int focused_dimy = focused_box.y_max - focused_box.y_min;
+    int dy = focused_box.y_min - external_dimy / 2 + focused_dimy / 2;
+    dy = std::max(0, std::min(internal_dimy - external_dimy - 1, dy));
+    const int content_y_min = box.y_min - dy;
+
+    // Build and lay out the visible rows only.
+    children_.clear();
+    if (count_ == 0 || box.y_max < box.y_min) {
+      return;
+    }
+    const int first = std::max(0, (box.y_min - content_y_min) / row_height_);
+    const int last =
+        std::min(count_ - 1, (box.y_max - content_y_min) / row_height_);
+    for (int i = first; i <= last; ++i) {
+      Element row = row_(i);
+      Box row_box = box;
+      row_box.y_min = content_y_min + i * row_height_;
+      row_box.y_max = row_box.y_min + row_height_ - 1;
+
+      Node::Status status;
+      row->Check(&status);
+      const int max_iterations = 20;
+      while (status.need_iteration && status.iteration < max_iterations) {
+        row->ComputeRequirementCached();
+        row->SetBoxCached(row_box);
+        status.need_iteration = false;
+        status.iteration++;
+        row->Check(&status);
+      }
+      children_.push_back(std::move(row));
+    }
+  }
+
+  void Render(Screen& screen) override {
+    const AutoReset<Box> stencil(&screen.stencil,
+                                 Box::Intersection(box_, screen.stencil));
+    Node::Render(screen);
+  }
+
+ private:
+  int count_;
+  int row_height_;
+  std::function<Element(int)> row_;
+  int focused_;
+};
+
+}  // namespace
+
+/// @brief A scrollable list of |count| rows, each |row_height| tall. Only the
+/// rows intersecting its box are built, by calling |row| with their index.
+/// The list scrolls to make the |focused| row visible, like `yframe`.
+/// @param count The number of rows.
+/// @param row_height The height of every row.
+/// @param row A function returning the element of the row at a given index.
+/// @param focused The index of the focused row, or -1.
+/// @ingroup dom
+///
+/// The time and memory needed per frame only depend on the number of visible
+/// rows. Use it in place of `vbox(...) | yframe`, not inside a frame: it would
+/// then be given a box large enough to hold every row.
+///
+/// ### Example
+///
+/// ```cpp
+/// auto document = virtualList(1'000'000, 1, [](int i) {
+///   return text("Line " + std::to_string(i));
+/// }, 500'000);
+/// ```
+Element virtualList(int count,
+                    int row_height,
+                    std::function<Element(int)> row,
+                    int focused) {
+  return MakeNode<VirtualList>(count, row_height, std::move(row),
+                                       focused);
+}
+
+}  // namespace ftxui
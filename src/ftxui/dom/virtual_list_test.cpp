@@ -0,0 +1,81 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>  // for to_string, string
+#include <vector>  // for vector
+
+#include "ftxui/dom/elements.hpp"   // for text, virtualList, Element
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(VirtualListElementTest, BuildsVisibleRowsOnly) {
+  std::vector<int> built;
+  auto element = virtualList(1'000'000, 1, [&](int i) {
+    built.push_back(i);
+    return text(std::to_string(i));
+  });
+  Screen screen(3, 3);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            "0  \r\n"
+            "1  \r\n"
+            "2  ");
+  EXPECT_EQ(built, std::vector<int>({0, 1, 2}));
+}
+
+TEST(VirtualListElementTest, ScrollToFocused) {
+  std::vector<int> built;
+  auto row = [&](int i) {
+    built.push_back(i);
+    return text(std::to_string(i));
+  };
+
+  Screen screen(3, 3);
+  Render(screen, virtualList(1000, 1, row, 500));
+  EXPECT_EQ(screen.ToString(),
+            "499\r\n"
+            "500\r\n"
+            "501");
+  EXPECT_EQ(built, std::vector<int>({499, 500, 501}));
+
+  built.clear();
+  Render(screen, virtualList(1000, 1, row, 999));
+  EXPECT_EQ(screen.ToString(),
+            "997\r\n"
+            "998\r\n"
+            "999");
+  EXPECT_EQ(built, std::vector<int>({997, 998, 999}));
+}
+
+TEST(VirtualListElementTest, RowHeight) {
+  auto row = [](int i) {
+    return vbox({
+        text(std::to_string(i)),
+        text("-"),
+    });
+  };
+  Screen screen(2, 5);
+  Render(screen, virtualList(10, 2, row, 4));
+  EXPECT_EQ(screen.ToString(),
+            "3 \r\n"
+            "- \r\n"
+            "4 \r\n"
+            "- \r\n"
+            "5 ");
+}
+
+TEST(VirtualListElementTest, Empty) {
+  auto element = virtualList(0, 1, [](int i) { return text("x"); });
+  Screen screen(3, 2);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            "   \r\n"
+            "   ");
+}
+
+}  // namespace ftxui
+// NOLINTEND
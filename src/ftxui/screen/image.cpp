@@ -1,6 +1,7 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
+#include <algorithm>  // for fill, max, min
 #include <sstream>  // IWYU pragma: keep
 #include <string>
 #include <vector>
@@ -19,6 +20,8 @@ Image::Image(int dimx, int dimy)
       //pool_.resize(dimx_ * dimy_ * 2, 0); // needed only when non-ascii, will be allocated on demand
       pixels_.resize(dimx_ * dimy_);
    }
+   data_ = pixels_.data();
+   dirty_rows_.resize(std::max(dimy_, 0), 0);
 }
 
 /// @brief Deep-copy the contents of an image, pixel by pixel
@@ -27,7 +30,9 @@ Image::Image(const Image& rhs)
       dimx_(rhs.dimx_),
       dimy_(rhs.dimy_),
       pool_(rhs.pool_),
-      pixels_(rhs.pixels_) {}
+      pixels_(rhs.pixels_),
+      data_(pixels_.data()),
+      dirty_rows_(rhs.dirty_rows_) {}
 
 /// @brief Transfer ownership from another image
 Image::Image(Image&& rhs)
@@ -35,8 +40,11 @@ Image::Image(Image&& rhs)
       dimx_(rhs.dimx_),
       dimy_(rhs.dimy_),
       pool_(std::move(rhs.pool_)),
-      pixels_(std::move(rhs.pixels_)) {
+      pixels_(std::move(rhs.pixels_)),
+      data_(rhs.data_),
+      dirty_rows_(std::move(rhs.dirty_rows_)) {
    // reset source
+   rhs.data_ = nullptr;
    rhs.stencil = {0, 0, 0, 0};
    rhs.dimx_ = rhs.dimy_ = 0;
 }
@@ -48,6 +56,8 @@ Image& Image::operator = (const Image& rhs) {
    dimy_ = rhs.dimy_;
    pool_ = rhs.pool_;
    pixels_ = rhs.pixels_;
+   data_ = pixels_.data();
+   dirty_rows_ = rhs.dirty_rows_;
    return *this;
 }
 
@@ -58,15 +68,46 @@ Image& Image::operator = (Image&& rhs) {
    dimy_ = rhs.dimy_;
    pool_ = std::move(rhs.pool_);
    pixels_ = std::move(rhs.pixels_);
+   data_ = rhs.data_;
+   dirty_rows_ = std::move(rhs.dirty_rows_);
+   rhs.data_ = nullptr;
    rhs.stencil = {0, 0, 0, 0};
    rhs.dimx_ = rhs.dimy_ = 0;
    return *this;
 }
 
 /// @brief Clear all the pixels from the screen
+/// @details Only the dirty rows are reset, the others are already blank.
+/// Since no pixel refers to the pool anymore, it is also reset once it grew
+/// bigger than the pixels. Recurring graphemes being interned, this only
+/// happens when many distinct ones were drawn.
 void Image::Clear() {
-  for (auto& pixel : pixels_)
-    pixel.grapheme = ' ';
+  Pixel blank;
+  blank.grapheme = ' ';
+  for (int y = 0; y < dimy_; ++y) {
+    if (!dirty_rows_[y])
+      continue;
+    Pixel* row = data_ + y * dimx_;
+    std::fill(row, row + dimx_, blank);
+    dirty_rows_[y] = 0;
+  }
+
+  if (pool_.size() > static_cast<size_t>(dimx_ * dimy_))
+    pool_.Clear();
+}
+
+/// @brief Mark the rows in [y_min, y_max] as dirty
+void Image::MarkDirty(int y_min, int y_max) {
+  y_min = std::max(y_min, 0);
+  y_max = std::min(y_max, dimy_ - 1);
+  for (int y = y_min; y <= y_max; ++y)
+    dirty_rows_[y] = 1;
+}
+
+/// @brief Mark every row as dirty, for instance after writing through
+/// get_pixels()
+void Image::MarkAllDirty() {
+  std::fill(dirty_rows_.begin(), dirty_rows_.end(), 1);
 }
 
 }  // namespace ftxui
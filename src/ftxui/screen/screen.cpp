@@ -1,14 +1,14 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
+#include <array>    // for array
+#include <charconv>  // for to_chars
 #include <cstddef>  // for size_t
 #include <cstdint>
-#include <iostream>  // for operator<<, stringstream, basic_ostream, flush, cout, ostream
+#include <iostream>  // for operator<<, basic_ostream, flush, cout, ostream
 #include <limits>
-#include <map>      // for _Rb_tree_const_iterator, map, operator!=, operator==
-#include <unordered_map>      // for _Rb_tree_const_iterator, map, operator!=, operator==
-#include <sstream>  // IWYU pragma: keep
-#include <utility>  // for pair
+#include <string_view>  // for string_view
+#include <utility>      // for pair
 
 #include "ftxui/screen/image.hpp"  // for Image
 #include "ftxui/screen/pixel.hpp"  // for Pixel
@@ -68,343 +68,458 @@ void WindowsEmulateVT100Terminal() {
 }
 #endif
 
+// The bits of PixelStyle::style changing how a pixel is displayed. The
+// automerge flag only matters while rendering the DOM.
+const uint16_t kDisplayedStyleMask = [] {
+  PixelStyle automerge;
+  automerge.automerge = true;
+  return static_cast<uint16_t>(~automerge.style);
+}();
+
+// The whole sequences changing a single attribute, the most common
+// transitions. They are only used when none of the |exclusive| bits is set
+// afterward: bold and dim share their reset, and so do the two underlines.
+struct AttributeSequence {
+  uint16_t bit;
+  uint16_t exclusive;
+  const char* set;
+  const char* reset;
+};
+const std::array<AttributeSequence, 8> kAttributeSequences = [] {
+  PixelStyle bold;
+  bold.bold = true;
+  PixelStyle dim;
+  dim.dim = true;
+  PixelStyle underlined;
+  underlined.underlined = true;
+  PixelStyle underlined_double;
+  underlined_double.underlined_double = true;
+  PixelStyle blink;
+  blink.blink = true;
+  PixelStyle inverted;
+  inverted.inverted = true;
+  PixelStyle italic;
+  italic.italic = true;
+  PixelStyle strikethrough;
+  strikethrough.strikethrough = true;
+  return std::array<AttributeSequence, 8>{{
+      {bold.style, dim.style, "\x1B[1m", "\x1B[22m"},
+      {dim.style, bold.style, "\x1B[2m", "\x1B[22m"},
+      {underlined.style, underlined_double.style, "\x1B[4m", "\x1B[24m"},
+      {underlined_double.style, underlined.style, "\x1B[21m", "\x1B[24m"},
+      {blink.style, 0, "\x1B[5m", "\x1B[25m"},
+      {inverted.style, 0, "\x1B[7m", "\x1B[27m"},
+      {italic.style, 0, "\x1B[3m", "\x1B[23m"},
+      {strikethrough.style, 0, "\x1B[9m", "\x1B[29m"},
+  }};
+}();
+
+// Append |parameter| to the SGR sequence being built.
+FTXUI_FORCE_INLINE()
+void AppendParameter(std::string& out, const char* parameter) {
+  out += parameter;
+  out += ';';
+}
+
+// Append the sequences transforming the style of |prev| into the style of
+// |next|. A null pixel stands for the default style of the terminal.
+// Every attribute and color change is packed into a single SGR sequence.
 // NOLINTNEXTLINE(readability-function-cognitive-complexity)
 void UpdatePixelStyle(const Screen* screen,
-                      std::stringstream& ss,
+                      std::string& out,
                       const Pixel* prev,
                       const Pixel* next) {
-   if (!next) {
-        // See https://gist.github.com/egmontkob/eb114294efbcd5adb1944c9f3cb5feda
-        if (FTXUI_UNLIKELY(0 != prev->style.hyperlink)) {
-          ss << "\x1B]8;;" << screen->Hyperlink(0) << "\x1B\\";
-        }
+  static const PixelStyle default_style;
+  const PixelStyle& from = prev ? prev->style : default_style;
+  const PixelStyle& to = next ? next->style : default_style;
 
-        // Bold
-        if (FTXUI_UNLIKELY(prev->style.bold | prev->style.dim)) {
-          // BOLD_AND_DIM_RESET:
-          ss << (prev->style.bold || prev->style.dim ? "\x1B[22m" : "");
-        }
+  // See https://gist.github.com/egmontkob/eb114294efbcd5adb1944c9f3cb5feda
+  if (FTXUI_UNLIKELY(from.hyperlink != to.hyperlink)) {
+    out += "\x1B]8;;";
+    out += screen->Hyperlink(to.hyperlink);
+    out += "\x1B\\";
+  }
 
-        // Underline
-        if (FTXUI_UNLIKELY(0 != prev->style.underlined ||
-                           0 != prev->style.underlined_double)) {
-          ss << "\x1B[24m";  // UNDERLINE_RESET
-        }
+  const uint16_t changed = (from.style ^ to.style) & kDisplayedStyleMask;
+  const bool foreground_changed = from.foreground_color != to.foreground_color;
+  const bool background_changed = from.background_color != to.background_color;
+  if (FTXUI_LIKELY(!changed && !foreground_changed && !background_changed)) {
+    return;
+  }
 
-        // Blink
-        if (FTXUI_UNLIKELY(0 != prev->style.blink)) {
-          ss << "\x1B[25m";  // BLINK_RESET
-        }
+  // Going back to the default style: a single reset is the shortest form.
+  if ((to.style & kDisplayedStyleMask) == 0 &&
+      to.foreground_color == Color::Default &&
+      to.background_color == Color::Default) {
+    out += "\x1B[0m";  // RESET
+    return;
+  }
 
-        // Inverted
-        if (FTXUI_UNLIKELY(0 != prev->style.inverted)) {
-          ss << "\x1B[27m";  // INVERTED_RESET
-        }
+  // A single attribute changed: use its precomputed sequence.
+  if (!foreground_changed && !background_changed &&
+      (changed & (changed - 1)) == 0) {
+    for (const AttributeSequence& sequence : kAttributeSequences) {
+      if (sequence.bit != changed) {
+        continue;
+      }
+      if ((to.style & sequence.exclusive) == 0) {
+        out += (to.style & changed) ? sequence.set : sequence.reset;
+        return;
+      }
+      break;
+    }
+  }
 
-        // Italics
-        if (FTXUI_UNLIKELY(0 != prev->style.italic)) {
-          ss << "\x1B[23m";  // ITALIC_RESET
-        }
+  out += "\x1B[";
 
-        // StrikeThrough
-        if (FTXUI_UNLIKELY(0 != prev->style.strikethrough)) {
-          ss << "\x1B[29m";  // CROSSED_OUT_RESET
-        }
+  // Only the colors changed: skip the attributes.
+  if (changed) {
+    // Bold and dim share the same reset.
+    if ((from.bold && !to.bold) || (from.dim && !to.dim)) {
+      AppendParameter(out, "22");  // BOLD_AND_DIM_RESET
+      if (to.bold) {
+        AppendParameter(out, "1");  // BOLD_SET
+      }
+      if (to.dim) {
+        AppendParameter(out, "2");  // DIM_SET
+      }
+    } else {
+      if (to.bold && !from.bold) {
+        AppendParameter(out, "1");  // BOLD_SET
+      }
+      if (to.dim && !from.dim) {
+        AppendParameter(out, "2");  // DIM_SET
+      }
+    }
 
-        if (FTXUI_UNLIKELY(Color(Color::Default) != prev->style.foreground_color ||
-                           Color(Color::Default) != prev->style.background_color)) {
-          ss << "\x1B[" + Color(Color::Default).Print(false) + "m";
-          ss << "\x1B[" + Color(Color::Default).Print(true) + "m";
-        }
+    // Underline
+    if (from.underlined != to.underlined ||
+        from.underlined_double != to.underlined_double) {
+      AppendParameter(out, to.underlined          ? "4"     // UNDERLINE
+                           : to.underlined_double ? "21"    // UNDERLINE_DOUBLE
+                                                  : "24");  // UNDERLINE_RESET
+    }
 
-      return;
-   }
-
-   if (!prev) {
-     // See https://gist.github.com/egmontkob/eb114294efbcd5adb1944c9f3cb5feda
-     if (FTXUI_UNLIKELY(next->style.hyperlink != 0)) {
-       ss << "\x1B]8;;" << screen->Hyperlink(next->style.hyperlink) << "\x1B\\";
-     }
-
-     // Bold
-     if (FTXUI_UNLIKELY(next->style.bold | next->style.dim)) {
-       // BOLD_AND_DIM_RESET:
-       ss << (next->style.bold ? "\x1B[1m" : "");  // BOLD_SET
-       ss << (next->style.dim ? "\x1B[2m" : "");   // DIM_SET
-     }
-
-     // Underline
-     if (FTXUI_UNLIKELY(next->style.underlined != 0 ||
-                        next->style.underlined_double != 0)) {
-       ss << (next->style.underlined          ? "\x1B[4m"     // UNDERLINE
-              : next->style.underlined_double ? "\x1B[21m"    // UNDERLINE_DOUBLE
-                                       : "\x1B[24m");  // UNDERLINE_RESET
-     }
-
-     // Blink
-     if (FTXUI_UNLIKELY(next->style.blink != 0)) {
-       ss << (next->style.blink ? "\x1B[5m"     // BLINK_SET
-                         : "\x1B[25m");  // BLINK_RESET
-     }
-
-     // Inverted
-     if (FTXUI_UNLIKELY(next->style.inverted != 0)) {
-       ss << (next->style.inverted ? "\x1B[7m"     // INVERTED_SET
-                            : "\x1B[27m");  // INVERTED_RESET
-     }
-
-     // Italics
-     if (FTXUI_UNLIKELY(next->style.italic != 0)) {
-       ss << (next->style.italic ? "\x1B[3m"     // ITALIC_SET
-                          : "\x1B[23m");  // ITALIC_RESET
-     }
-
-     // StrikeThrough
-     if (FTXUI_UNLIKELY(next->style.strikethrough != 0)) {
-       ss << (next->style.strikethrough ? "\x1B[9m"     // CROSSED_OUT
-                                 : "\x1B[29m");  // CROSSED_OUT_RESET
-     }
-
-     if (FTXUI_UNLIKELY(next->style.foreground_color != Color(Color::Default) ||
-                        next->style.background_color != Color(Color::Default))) {
-       ss << "\x1B[" + next->style.foreground_color.Print(false) + "m";
-       ss << "\x1B[" + next->style.background_color.Print(true) + "m";
-     }
-     return;
-   }
+    // Blink
+    if (from.blink != to.blink) {
+      AppendParameter(out, to.blink ? "5"     // BLINK_SET
+                                    : "25");  // BLINK_RESET
+    }
 
-  // See https://gist.github.com/egmontkob/eb114294efbcd5adb1944c9f3cb5feda
-  if (FTXUI_UNLIKELY(next->style.hyperlink != prev->style.hyperlink)) {
-    ss << "\x1B]8;;" << screen->Hyperlink(next->style.hyperlink) << "\x1B\\";
-  }
+    // Inverted
+    if (from.inverted != to.inverted) {
+      AppendParameter(out, to.inverted ? "7"     // INVERTED_SET
+                                       : "27");  // INVERTED_RESET
+    }
 
-  // Bold
-  if (FTXUI_UNLIKELY((next->style.bold ^ prev->style.bold) | (next->style.dim ^ prev->style.dim))) {
-    // BOLD_AND_DIM_RESET:
-    ss << ((prev->style.bold && !next->style.bold) || (prev->style.dim && !next->style.dim) ? "\x1B[22m"
-                                                                : "");
-    ss << (next->style.bold ? "\x1B[1m" : "");  // BOLD_SET
-    ss << (next->style.dim ? "\x1B[2m" : "");   // DIM_SET
-  }
+    // Italics
+    if (from.italic != to.italic) {
+      AppendParameter(out, to.italic ? "3"     // ITALIC_SET
+                                     : "23");  // ITALIC_RESET
+    }
 
-  // Underline
-  if (FTXUI_UNLIKELY(next->style.underlined != prev->style.underlined ||
-                     next->style.underlined_double != prev->style.underlined_double)) {
-    ss << (next->style.underlined          ? "\x1B[4m"     // UNDERLINE
-           : next->style.underlined_double ? "\x1B[21m"    // UNDERLINE_DOUBLE
-                                    : "\x1B[24m");  // UNDERLINE_RESET
+    // StrikeThrough
+    if (from.strikethrough != to.strikethrough) {
+      AppendParameter(out, to.strikethrough ? "9"     // CROSSED_OUT
+                                            : "29");  // CROSSED_OUT_RESET
+    }
   }
 
-  // Blink
-  if (FTXUI_UNLIKELY(next->style.blink != prev->style.blink)) {
-    ss << (next->style.blink ? "\x1B[5m"     // BLINK_SET
-                      : "\x1B[25m");  // BLINK_RESET
+  if (foreground_changed) {
+    to.foreground_color.Print(false, out);
+    out += ';';
   }
 
-  // Inverted
-  if (FTXUI_UNLIKELY(next->style.inverted != prev->style.inverted)) {
-    ss << (next->style.inverted ? "\x1B[7m"     // INVERTED_SET
-                         : "\x1B[27m");  // INVERTED_RESET
+  if (background_changed) {
+    to.background_color.Print(true, out);
+    out += ';';
   }
 
-  // Italics
-  if (FTXUI_UNLIKELY(next->style.italic != prev->style.italic)) {
-    ss << (next->style.italic ? "\x1B[3m"     // ITALIC_SET
-                       : "\x1B[23m");  // ITALIC_RESET
+  // Close the sequence, replacing the trailing separator.
+  out.back() = 'm';
+}
+
+// Return whether two pixels, taken from their respective screens, are displayed
+// identically on the terminal.
+bool SamePixel(const Screen& a,
+               const Pixel& pa,
+               const Screen& b,
+               const Pixel& pb) {
+  if (((pa.style.style ^ pb.style.style) & kDisplayedStyleMask) != 0 ||
+      pa.style.foreground_color != pb.style.foreground_color ||
+      pa.style.background_color != pb.style.background_color) {
+    return false;
   }
 
-  // StrikeThrough
-  if (FTXUI_UNLIKELY(next->style.strikethrough != prev->style.strikethrough)) {
-    ss << (next->style.strikethrough ? "\x1B[9m"     // CROSSED_OUT
-                              : "\x1B[29m");  // CROSSED_OUT_RESET
+  if (FTXUI_UNLIKELY(pa.style.hyperlink != 0 || pb.style.hyperlink != 0) &&
+      a.Hyperlink(pa.style.hyperlink) != b.Hyperlink(pb.style.hyperlink)) {
+    return false;
   }
 
-  if (FTXUI_UNLIKELY(next->style.foreground_color != prev->style.foreground_color ||
-                     next->style.background_color != prev->style.background_color)) {
-    ss << "\x1B[" + next->style.foreground_color.Print(false) + "m";
-    ss << "\x1B[" + next->style.background_color.Print(true) + "m";
+  return pa.get_view(a.get_pool()) == pb.get_view(b.get_pool());
+}
+
+// Return whether the pixel holds a character spanning over two cells.
+bool IsFullWidth(const Screen& screen, const Pixel& pixel) {
+  if (FTXUI_LIKELY(pixel.grapheme.is_small() &&
+                   pixel.grapheme.get_size() <= 1)) {
+    return false;
   }
+  return string_width(pixel.get_view(screen.get_pool())) == 2;
 }
 
-struct TileEncoding {
-  std::uint8_t left : 2;
-  std::uint8_t top : 2;
-  std::uint8_t right : 2;
-  std::uint8_t down : 2;
-  std::uint8_t round : 1;
+// Append the decimal representation of |value| to |out|.
+void AppendInt(std::string& out, int value) {
+  std::array<char, 16> buffer;  // NOLINT
+  const auto result =
+      std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+  out.append(buffer.data(), result.ptr);
+}
 
-  // clang-format off
-  bool operator<(const TileEncoding& other) const {
-    if (left < other.left)   { return  true;  }
-    if (left > other.left)   { return  false; }
-    if (top < other.top)     { return  true;  }
-    if (top > other.top)     { return  false; }
-    if (right < other.right) { return  true;  }
-    if (right > other.right) { return  false; }
-    if (down < other.down)   { return  true;  }
-    if (down > other.down)   { return  false; }
-    if (round < other.round) { return  true;  }
-    if (round > other.round) { return  false; }
-      return false;
-  }
-  // clang-format on
+// Append the sequence moving the cursor to the 0-based cell (x, y).
+void MoveTo(std::string& out, int x, int y) {
+  out += "\x1B[";
+  AppendInt(out, y + 1);
+  out += ';';
+  AppendInt(out, x + 1);
+  out += 'H';
+}
+
+// A box drawing character, described by the weight of its four branches:
+// 0 for none, 1 for light, 2 for heavy and 3 for double.
+struct Tile {
+  const char* glyph;
+  std::uint8_t left;
+  std::uint8_t top;
+  std::uint8_t right;
+  std::uint8_t down;
+  std::uint8_t round;
 };
 
 // clang-format off
-const std::unordered_map<PackedString, TileEncoding> tile_encoding = { // NOLINT
-    {"─", {1, 0, 1, 0, 0}},
-    {"━", {2, 0, 2, 0, 0}},
-    {"╍", {2, 0, 2, 0, 0}},
-
-    {"│", {0, 1, 0, 1, 0}},
-    {"┃", {0, 2, 0, 2, 0}},
-    {"╏", {0, 2, 0, 2, 0}},
-
-    {"┌", {0, 0, 1, 1, 0}},
-    {"┍", {0, 0, 2, 1, 0}},
-    {"┎", {0, 0, 1, 2, 0}},
-    {"┏", {0, 0, 2, 2, 0}},
-
-    {"┐", {1, 0, 0, 1, 0}},
-    {"┑", {2, 0, 0, 1, 0}},
-    {"┒", {1, 0, 0, 2, 0}},
-    {"┓", {2, 0, 0, 2, 0}},
-
-    {"└", {0, 1, 1, 0, 0}},
-    {"┕", {0, 1, 2, 0, 0}},
-    {"┖", {0, 2, 1, 0, 0}},
-    {"┗", {0, 2, 2, 0, 0}},
-
-    {"┘", {1, 1, 0, 0, 0}},
-    {"┙", {2, 1, 0, 0, 0}},
-    {"┚", {1, 2, 0, 0, 0}},
-    {"┛", {2, 2, 0, 0, 0}},
-
-    {"├", {0, 1, 1, 1, 0}},
-    {"┝", {0, 1, 2, 1, 0}},
-    {"┞", {0, 2, 1, 1, 0}},
-    {"┟", {0, 1, 1, 2, 0}},
-    {"┠", {0, 2, 1, 2, 0}},
-    {"┡", {0, 2, 2, 1, 0}},
-    {"┢", {0, 1, 2, 2, 0}},
-    {"┣", {0, 2, 2, 2, 0}},
-
-    {"┤", {1, 1, 0, 1, 0}},
-    {"┥", {2, 1, 0, 1, 0}},
-    {"┦", {1, 2, 0, 1, 0}},
-    {"┧", {1, 1, 0, 2, 0}},
-    {"┨", {1, 2, 0, 2, 0}},
-    {"┩", {2, 2, 0, 1, 0}},
-    {"┪", {2, 1, 0, 2, 0}},
-    {"┫", {2, 2, 0, 2, 0}},
-
-    {"┬", {1, 0, 1, 1, 0}},
-    {"┭", {2, 0, 1, 1, 0}},
-    {"┮", {1, 0, 2, 1, 0}},
-    {"┯", {2, 0, 2, 1, 0}},
-    {"┰", {1, 0, 1, 2, 0}},
-    {"┱", {2, 0, 1, 2, 0}},
-    {"┲", {1, 0, 2, 2, 0}},
-    {"┳", {2, 0, 2, 2, 0}},
-
-    {"┴", {1, 1, 1, 0, 0}},
-    {"┵", {2, 1, 1, 0, 0}},
-    {"┶", {1, 1, 2, 0, 0}},
-    {"┷", {2, 1, 2, 0, 0}},
-    {"┸", {1, 2, 1, 0, 0}},
-    {"┹", {2, 2, 1, 0, 0}},
-    {"┺", {1, 2, 2, 0, 0}},
-    {"┻", {2, 2, 2, 0, 0}},
-
-    {"┼", {1, 1, 1, 1, 0}},
-    {"┽", {2, 1, 1, 1, 0}},
-    {"┾", {1, 1, 2, 1, 0}},
-    {"┿", {2, 1, 2, 1, 0}},
-    {"╀", {1, 2, 1, 1, 0}},
-    {"╁", {1, 1, 1, 2, 0}},
-    {"╂", {1, 2, 1, 2, 0}},
-    {"╃", {2, 2, 1, 1, 0}},
-    {"╄", {1, 2, 2, 1, 0}},
-    {"╅", {2, 1, 1, 2, 0}},
-    {"╆", {1, 1, 2, 2, 0}},
-    {"╇", {2, 2, 2, 1, 0}},
-    {"╈", {2, 1, 2, 2, 0}},
-    {"╉", {2, 2, 1, 2, 0}},
-    {"╊", {1, 2, 2, 2, 0}},
-    {"╋", {2, 2, 2, 2, 0}},
-
-    {"═", {3, 0, 3, 0, 0}},
-    {"║", {0, 3, 0, 3, 0}},
-
-    {"╒", {0, 0, 3, 1, 0}},
-    {"╓", {0, 0, 1, 3, 0}},
-    {"╔", {0, 0, 3, 3, 0}},
-
-    {"╕", {3, 0, 0, 1, 0}},
-    {"╖", {1, 0, 0, 3, 0}},
-    {"╗", {3, 0, 0, 3, 0}},
-
-    {"╘", {0, 1, 3, 0, 0}},
-    {"╙", {0, 3, 1, 0, 0}},
-    {"╚", {0, 3, 3, 0, 0}},
-
-    {"╛", {3, 1, 0, 0, 0}},
-    {"╜", {1, 3, 0, 0, 0}},
-    {"╝", {3, 3, 0, 0, 0}},
-
-    {"╞", {0, 1, 3, 1, 0}},
-    {"╟", {0, 3, 1, 3, 0}},
-    {"╠", {0, 3, 3, 3, 0}},
-
-    {"╡", {3, 1, 0, 1, 0}},
-    {"╢", {1, 3, 0, 3, 0}},
-    {"╣", {3, 3, 0, 3, 0}},
-
-    {"╤", {3, 0, 3, 1, 0}},
-    {"╥", {1, 0, 1, 3, 0}},
-    {"╦", {3, 0, 3, 3, 0}},
-
-    {"╧", {3, 1, 3, 0, 0}},
-    {"╨", {1, 3, 1, 0, 0}},
-    {"╩", {3, 3, 3, 0, 0}},
-
-    {"╪", {3, 1, 3, 1, 0}},
-    {"╫", {1, 3, 1, 3, 0}},
-    {"╬", {3, 3, 3, 3, 0}},
-
-    {"╭", {0, 0, 1, 1, 1}},
-    {"╮", {1, 0, 0, 1, 1}},
-    {"╯", {1, 1, 0, 0, 1}},
-    {"╰", {0, 1, 1, 0, 1}},
-
-    {"╴", {1, 0, 0, 0, 0}},
-    {"╵", {0, 1, 0, 0, 0}},
-    {"╶", {0, 0, 1, 0, 0}},
-    {"╷", {0, 0, 0, 1, 0}},
-
-    {"╸", {2, 0, 0, 0, 0}},
-    {"╹", {0, 2, 0, 0, 0}},
-    {"╺", {0, 0, 2, 0, 0}},
-    {"╻", {0, 0, 0, 2, 0}},
-
-    {"╼", {1, 0, 2, 0, 0}},
-    {"╽", {0, 1, 0, 2, 0}},
-    {"╾", {2, 0, 1, 0, 0}},
-    {"╿", {0, 2, 0, 1, 0}},
+constexpr Tile kTiles[] = {
+    {"─", 1, 0, 1, 0, 0},
+    {"━", 2, 0, 2, 0, 0},
+    {"╍", 2, 0, 2, 0, 0},
+
+    {"│", 0, 1, 0, 1, 0},
+    {"┃", 0, 2, 0, 2, 0},
+    {"╏", 0, 2, 0, 2, 0},
+
+    {"┌", 0, 0, 1, 1, 0},
+    {"┍", 0, 0, 2, 1, 0},
+    {"┎", 0, 0, 1, 2, 0},
+    {"┏", 0, 0, 2, 2, 0},
+
+    {"┐", 1, 0, 0, 1, 0},
+    {"┑", 2, 0, 0, 1, 0},
+    {"┒", 1, 0, 0, 2, 0},
+    {"┓", 2, 0, 0, 2, 0},
+
+    {"└", 0, 1, 1, 0, 0},
+    {"┕", 0, 1, 2, 0, 0},
+    {"┖", 0, 2, 1, 0, 0},
+    {"┗", 0, 2, 2, 0, 0},
+
+    {"┘", 1, 1, 0, 0, 0},
+    {"┙", 2, 1, 0, 0, 0},
+    {"┚", 1, 2, 0, 0, 0},
+    {"┛", 2, 2, 0, 0, 0},
+
+    {"├", 0, 1, 1, 1, 0},
+    {"┝", 0, 1, 2, 1, 0},
+    {"┞", 0, 2, 1, 1, 0},
+    {"┟", 0, 1, 1, 2, 0},
+    {"┠", 0, 2, 1, 2, 0},
+    {"┡", 0, 2, 2, 1, 0},
+    {"┢", 0, 1, 2, 2, 0},
+    {"┣", 0, 2, 2, 2, 0},
+
+    {"┤", 1, 1, 0, 1, 0},
+    {"┥", 2, 1, 0, 1, 0},
+    {"┦", 1, 2, 0, 1, 0},
+    {"┧", 1, 1, 0, 2, 0},
+    {"┨", 1, 2, 0, 2, 0},
+    {"┩", 2, 2, 0, 1, 0},
+    {"┪", 2, 1, 0, 2, 0},
+    {"┫", 2, 2, 0, 2, 0},
+
+    {"┬", 1, 0, 1, 1, 0},
+    {"┭", 2, 0, 1, 1, 0},
+    {"┮", 1, 0, 2, 1, 0},
+    {"┯", 2, 0, 2, 1, 0},
+    {"┰", 1, 0, 1, 2, 0},
+    {"┱", 2, 0, 1, 2, 0},
+    {"┲", 1, 0, 2, 2, 0},
+    {"┳", 2, 0, 2, 2, 0},
+
+    {"┴", 1, 1, 1, 0, 0},
+    {"┵", 2, 1, 1, 0, 0},
+    {"┶", 1, 1, 2, 0, 0},
+    {"┷", 2, 1, 2, 0, 0},
+    {"┸", 1, 2, 1, 0, 0},
+    {"┹", 2, 2, 1, 0, 0},
+    {"┺", 1, 2, 2, 0, 0},
+    {"┻", 2, 2, 2, 0, 0},
+
+    {"┼", 1, 1, 1, 1, 0},
+    {"┽", 2, 1, 1, 1, 0},
+    {"┾", 1, 1, 2, 1, 0},
+    {"┿", 2, 1, 2, 1, 0},
+    {"╀", 1, 2, 1, 1, 0},
+    {"╁", 1, 1, 1, 2, 0},
+    {"╂", 1, 2, 1, 2, 0},
+    {"╃", 2, 2, 1, 1, 0},
+    {"╄", 1, 2, 2, 1, 0},
+    {"╅", 2, 1, 1, 2, 0},
+    {"╆", 1, 1, 2, 2, 0},
+    {"╇", 2, 2, 2, 1, 0},
+    {"╈", 2, 1, 2, 2, 0},
+    {"╉", 2, 2, 1, 2, 0},
+    {"╊", 1, 2, 2, 2, 0},
+    {"╋", 2, 2, 2, 2, 0},
+
+    {"═", 3, 0, 3, 0, 0},
+    {"║", 0, 3, 0, 3, 0},
+
+    {"╒", 0, 0, 3, 1, 0},
+    {"╓", 0, 0, 1, 3, 0},
+    {"╔", 0, 0, 3, 3, 0},
+
+    {"╕", 3, 0, 0, 1, 0},
+    {"╖", 1, 0, 0, 3, 0},
+    {"╗", 3, 0, 0, 3, 0},
+
+    {"╘", 0, 1, 3, 0, 0},
+    {"╙", 0, 3, 1, 0, 0},
+    {"╚", 0, 3, 3, 0, 0},
+
+    {"╛", 3, 1, 0, 0, 0},
+    {"╜", 1, 3, 0, 0, 0},
+    {"╝", 3, 3, 0, 0, 0},
+
+    {"╞", 0, 1, 3, 1, 0},
+    {"╟", 0, 3, 1, 3, 0},
+    {"╠", 0, 3, 3, 3, 0},
+
+    {"╡", 3, 1, 0, 1, 0},
+    {"╢", 1, 3, 0, 3, 0},
+    {"╣", 3, 3, 0, 3, 0},
+
+    {"╤", 3, 0, 3, 1, 0},
+    {"╥", 1, 0, 1, 3, 0},
+    {"╦", 3, 0, 3, 3, 0},
+
+    {"╧", 3, 1, 3, 0, 0},
+    {"╨", 1, 3, 1, 0, 0},
+    {"╩", 3, 3, 3, 0, 0},
+
+    {"╪", 3, 1, 3, 1, 0},
+    {"╫", 1, 3, 1, 3, 0},
+    {"╬", 3, 3, 3, 3, 0},
+
+    {"╭", 0, 0, 1, 1, 1},
+    {"╮", 1, 0, 0, 1, 1},
+    {"╯", 1, 1, 0, 0, 1},
+    {"╰", 0, 1, 1, 0, 1},
+
+    {"╴", 1, 0, 0, 0, 0},
+    {"╵", 0, 1, 0, 0, 0},
+    {"╶", 0, 0, 1, 0, 0},
+    {"╷", 0, 0, 0, 1, 0},
+
+    {"╸", 2, 0, 0, 0, 0},
+    {"╹", 0, 2, 0, 0, 0},
+    {"╺", 0, 0, 2, 0, 0},
+    {"╻", 0, 0, 0, 2, 0},
+
+    {"╼", 1, 0, 2, 0, 0},
+    {"╽", 0, 1, 0, 2, 0},
+    {"╾", 2, 0, 1, 0, 0},
+    {"╿", 0, 2, 0, 1, 0},
 };
 // clang-format on
 
-template <class A, class B>
-std::map<B, A> InvertMap(const std::unordered_map<A, B> input) {
-  std::map<B, A> output;
-  for (const auto& it : input) {
-    output[it.second] = it.first;
+// Box drawing characters are U+2500..U+257F. They are encoded in UTF-8 as
+// E2 94 80..E2 95 BF, and map to a 7-bit index.
+constexpr int kTileCount = 128;
+constexpr std::uint8_t kNoTile = 0xFF;
+
+constexpr int TileIndex(const char* glyph) {
+  return ((static_cast<std::uint8_t>(glyph[1]) - 0x94) << 6) |  // NOLINT
+         (static_cast<std::uint8_t>(glyph[2]) & 0x3F);          // NOLINT
+}
+
+// The branches of a tile, packed as: left | top << 2 | right << 4 | down << 6 |
+// round << 8.
+constexpr int kLeftShift = 0;
+constexpr int kTopShift = 2;
+constexpr int kRightShift = 4;
+constexpr int kDownShift = 6;
+constexpr int kEncodingCount = 512;
+constexpr std::uint16_t kNoEncoding = 0xFFFF;
+
+constexpr std::uint16_t Encode(const Tile& tile) {
+  return static_cast<std::uint16_t>(
+      tile.left << kLeftShift | tile.top << kTopShift |
+      tile.right << kRightShift | tile.down << kDownShift | tile.round << 8);
+}
+
+constexpr int Branch(std::uint16_t encoding, int shift) {
+  return (encoding >> shift) & 3;  // NOLINT
+}
+
+// Tile index -> encoding.
+constexpr auto kTileEncoding = [] {
+  std::array<std::uint16_t, kTileCount> table{};
+  for (auto& it : table) {
+    it = kNoEncoding;
+  }
+  for (const Tile& tile : kTiles) {
+    table[TileIndex(tile.glyph)] = Encode(tile);  // NOLINT
+  }
+  return table;
+}();
+
+// Encoding -> tile index. When several tiles share an encoding, the first one
+// listed is used.
+constexpr auto kEncodingTile = [] {
+  std::array<std::uint8_t, kEncodingCount> table{};
+  for (auto& it : table) {
+    it = kNoTile;
+  }
+  for (const Tile& tile : kTiles) {
+    auto& it = table[Encode(tile)];  // NOLINT
+    if (it == kNoTile) {
+      it = static_cast<std::uint8_t>(TileIndex(tile.glyph));
+    }
+  }
+  return table;
+}();
+
+// Return the encoding of a 3 bytes |grapheme|, or kNoEncoding.
+FTXUI_FORCE_INLINE() std::uint16_t TileEncodingOf(const PackedString& grapheme) {
+  const std::string_view glyph = grapheme.get_view();
+  if (glyph[0] != '\xE2' || (glyph[1] != '\x94' && glyph[1] != '\x95')) {
+    return kNoEncoding;
   }
-  return output;
+  return kTileEncoding[TileIndex(glyph.data())];  // NOLINT
 }
 
-const std::map<TileEncoding, PackedString> tile_encoding_inverse =  // NOLINT
-    InvertMap(tile_encoding);
+// Replace |grapheme| by the tile with the given |encoding|, if it exists.
+FTXUI_FORCE_INLINE() void SetTile(PackedString& grapheme,
+                                  std::uint16_t encoding) {
+  const std::uint8_t index = kEncodingTile[encoding];  // NOLINT
+  if (index == kNoTile) {
+    return;
+  }
+  const std::array<char, 3> glyph = {
+      '\xE2',
+      static_cast<char>(0x94 + (index >> 6)),    // NOLINT
+      static_cast<char>(0x80 | (index & 0x3F)),  // NOLINT
+  };
+  grapheme = std::string_view(glyph.data(), glyph.size());
+}
 
 }  // namespace
 
@@ -449,59 +564,45 @@ Screen::Screen(int dimx, int dimy) : Image{dimx, dimy} {
 
 // @attention assumes both pixels are small
 void Screen::UpgradeLeftRight(Pixel& left, Pixel& right) {
-  const auto it_left = tile_encoding.find(left.grapheme);
-  if (it_left == tile_encoding.end())
+  const std::uint16_t encoding_left = TileEncodingOf(left.grapheme);
+  if (encoding_left == kNoEncoding)
     return;
 
-  const auto it_right = tile_encoding.find(right.grapheme);
-  if (it_right == tile_encoding.end())
+  const std::uint16_t encoding_right = TileEncodingOf(right.grapheme);
+  if (encoding_right == kNoEncoding)
     return;
 
-  if (it_left->second.right == 0 && it_right->second.left != 0) {
-    TileEncoding encoding_left = it_left->second;
-    encoding_left.right = it_right->second.left;
-    const auto it_left_upgrade = tile_encoding_inverse.find(encoding_left);
-    if (it_left_upgrade != tile_encoding_inverse.end()) {
-      left.grapheme = it_left_upgrade->second;
-    }
+  const int left_right = Branch(encoding_left, kRightShift);
+  const int right_left = Branch(encoding_right, kLeftShift);
+
+  if (left_right == 0 && right_left != 0) {
+    SetTile(left.grapheme, encoding_left | right_left << kRightShift);
   }
 
-  if (it_right->second.left == 0 && it_left->second.right != 0) {
-    TileEncoding encoding_right = it_right->second;
-    encoding_right.left = it_left->second.right;
-    const auto it_right_upgrade = tile_encoding_inverse.find(encoding_right);
-    if (it_right_upgrade != tile_encoding_inverse.end()) {
-      right.grapheme = it_right_upgrade->second;
-    }
+  if (right_left == 0 && left_right != 0) {
+    SetTile(right.grapheme, encoding_right | left_right << kLeftShift);
   }
 }
 
 // @attention assumes both pixels are small
 void Screen::UpgradeTopDown(Pixel& top, Pixel& down) {
-  const auto it_top = tile_encoding.find(top.grapheme);
-  if (it_top == tile_encoding.end())
+  const std::uint16_t encoding_top = TileEncodingOf(top.grapheme);
+  if (encoding_top == kNoEncoding)
     return;
 
-  const auto it_down = tile_encoding.find(down.grapheme);
-  if (it_down == tile_encoding.end())
+  const std::uint16_t encoding_down = TileEncodingOf(down.grapheme);
+  if (encoding_down == kNoEncoding)
     return;
 
-  if (it_top->second.down == 0 && it_down->second.top != 0) {
-    TileEncoding encoding_top = it_top->second;
-    encoding_top.down = it_down->second.top;
-    const auto it_top_down = tile_encoding_inverse.find(encoding_top);
-    if (it_top_down != tile_encoding_inverse.end()) {
-      top.grapheme = it_top_down->second;
-    }
+  const int top_down = Branch(encoding_top, kDownShift);
+  const int down_top = Branch(encoding_down, kTopShift);
+
+  if (top_down == 0 && down_top != 0) {
+    SetTile(top.grapheme, encoding_top | down_top << kDownShift);
   }
 
-  if (it_down->second.top == 0 && it_top->second.down != 0) {
-    TileEncoding encoding_down = it_down->second;
-    encoding_down.top = it_top->second.down;
-    const auto it_down_top = tile_encoding_inverse.find(encoding_down);
-    if (it_down_top != tile_encoding_inverse.end()) {
-      down.grapheme = it_down_top->second;
-    }
+  if (down_top == 0 && top_down != 0) {
+    SetTile(down.grapheme, encoding_down | top_down << kTopShift);
   }
 }
 
@@ -510,38 +611,155 @@ void Screen::UpgradeTopDown(Pixel& top, Pixel& down) {
 /// @note Don't forget to flush stdout. Alternatively, you can use
 /// Screen::Print();
 std::string Screen::ToString() const {
-  std::stringstream ss;
+  std::string out;
+  ToString(out);
+  return out;
+}
+
+/// Produce the output printing the Screen on the terminal into |out|.
+/// The previous content of |out| is replaced, but its capacity is reused. Once
+/// it has grown to the size of a frame, printing doesn't allocate anymore.
+/// @see ToString
+void Screen::ToString(std::string& out) const {
+  out.clear();
   const Pixel* previous_pixel_ref = nullptr;
 
   for (int y = 0; y < dimy_; ++y) {
     // New line in between two lines.
     if (y != 0) {
-      UpdatePixelStyle(this, ss, previous_pixel_ref, nullptr);
+      UpdatePixelStyle(this, out, previous_pixel_ref, nullptr);
       previous_pixel_ref = nullptr;
-      ss << "\r\n";
+      out += "\r\n";
+    }
+
+    // Rows never drawn since the last Clear() are blank.
+    if (!IsDirty(y)) {
+      out.append(dimx_, ' ');
+      continue;
     }
 
     // After printing a fullwith character, we need to skip the next cell.
     bool previous_fullwidth = false;
-    auto pixel_row = pixels_.data() + y * width();
+    auto pixel_row = data_ + y * width();
     for (auto pixel = pixel_row; pixel < pixel_row + width(); ++pixel) {
       if (!previous_fullwidth) {
-        UpdatePixelStyle(this, ss, previous_pixel_ref, pixel);
+        UpdatePixelStyle(this, out, previous_pixel_ref, pixel);
         previous_pixel_ref = pixel;
         if (pixel->grapheme.empty()) {
-          ss << ' ';
+          out += ' ';
+        } else {
+          out += pixel->grapheme.get_view(pool_);
+        }
+      }
+      previous_fullwidth = IsFullWidth(*this, *pixel);
+    }
+  }
+
+  // Reset the style to default:
+  if (previous_pixel_ref) {
+    UpdatePixelStyle(this, out, previous_pixel_ref, nullptr);
+  }
+}
+
+/// Produce a std::string transforming |previous|, as currently displayed on
+/// the terminal, into this Screen. Only the runs of modified cells are emitted,
+/// each one preceded by an absolute cursor move.
+///
+/// The output assumes the cursor is at the bottom-right corner of the drawing,
+/// where ToString() leaves it, with the default style. It leaves it there too.
+/// If the two screens have different dimensions, the whole screen is drawn
+/// again from the top-left corner.
+/// @see ToString
+std::string Screen::ToStringDiff(const Screen& previous) const {
+  std::string out;
+  ToStringDiff(previous, out);
+  return out;
+}
+
+/// Same as ToStringDiff(previous), but the output replaces the content of
+/// |out|, reusing its capacity.
+/// @see ToStringDiff
+void Screen::ToStringDiff(const Screen& previous, std::string& out) const {
+  if (previous.dimx_ != dimx_ || previous.dimy_ != dimy_) {
+    ToString(out);
+    out.insert(0, "\x1B[H");  // MOVE_HOME
+    return;
+  }
+
+  // Rewriting a few unchanged cells is cheaper than moving the cursor over
+  // them.
+  const int max_gap = 4;
+
+  out.clear();
+  const Pixel* previous_pixel_ref = nullptr;
+
+  for (int y = 0; y < dimy_; ++y) {
+    // Rows blank on both screens can't differ.
+    if (!IsDirty(y) && !previous.IsDirty(y)) {
+      continue;
+    }
+
+    const Pixel* row = data_ + y * dimx_;
+    const Pixel* previous_row = previous.data_ + y * dimx_;
+
+    int x = 0;
+    while (x < dimx_) {
+      // Skip the unchanged cells.
+      if (SamePixel(*this, row[x], previous, previous_row[x])) {
+        ++x;
+        continue;
+      }
+
+      // Find the end of the run of changed cells, absorbing small gaps.
+      int begin = x;
+      int end = x + 1;
+      int gap = 0;
+      for (x = end; x < dimx_ && gap <= max_gap; ++x) {
+        if (SamePixel(*this, row[x], previous, previous_row[x])) {
+          ++gap;
         } else {
-          ss << pixel->grapheme.get_view(pool_);
+          gap = 0;
+          end = x + 1;
+        }
+      }
+
+      // Never start or stop in the middle of a fullwidth character.
+      if (begin > 0 && (IsFullWidth(*this, row[begin - 1]) ||
+                        IsFullWidth(previous, previous_row[begin - 1]))) {
+        --begin;
+      }
+      if (end < dimx_ && (IsFullWidth(*this, row[end - 1]) ||
+                          IsFullWidth(previous, previous_row[end - 1]))) {
+        ++end;
+      }
+      x = end;
+
+      MoveTo(out, begin, y);
+
+      // After printing a fullwith character, we need to skip the next cell.
+      bool previous_fullwidth = false;
+      for (auto pixel = row + begin; pixel < row + end; ++pixel) {
+        if (!previous_fullwidth) {
+          UpdatePixelStyle(this, out, previous_pixel_ref, pixel);
+          previous_pixel_ref = pixel;
+          if (pixel->grapheme.empty()) {
+            out += ' ';
+          } else {
+            out += pixel->grapheme.get_view(pool_);
+          }
         }
+        previous_fullwidth = IsFullWidth(*this, *pixel);
       }
-      previous_fullwidth = (string_width(pixel->grapheme.get_view(pool_)) == 2);
     }
   }
 
   // Reset the style to default:
-  UpdatePixelStyle(this, ss, previous_pixel_ref, nullptr);
+  if (previous_pixel_ref) {
+    UpdatePixelStyle(this, out, previous_pixel_ref, nullptr);
+  }
 
-  return ss.str();
+  // Leave the cursor where ToString() would have:
+  MoveTo(out, dimx_ - 1, dimy_ - 1);
 }
 
 // Print the Screen to the terminal.
@@ -569,21 +787,21 @@ void Screen::Print() const {
 /// @return The string to print in order to reset the cursor position to the
 ///         beginning.
 std::string Screen::ResetPosition(bool clear) const {
-  std::stringstream ss;
+  std::string out;
   if (clear) {
-    ss << "\r";       // MOVE_LEFT;
-    ss << "\x1b[2K";  // CLEAR_SCREEN;
+    out += "\r";       // MOVE_LEFT;
+    out += "\x1b[2K";  // CLEAR_SCREEN;
     for (int y = 1; y < dimy_; ++y) {
-      ss << "\x1B[1A";  // MOVE_UP;
-      ss << "\x1B[2K";  // CLEAR_LINE;
+      out += "\x1B[1A";  // MOVE_UP;
+      out += "\x1B[2K";  // CLEAR_LINE;
     }
   } else {
-    ss << "\r";  // MOVE_LEFT;
+    out += "\r";  // MOVE_LEFT;
     for (int y = 1; y < dimy_; ++y) {
-      ss << "\x1B[1A";  // MOVE_UP;
+      out += "\x1B[1A";  // MOVE_UP;
     }
   }
-  return ss.str();
+  return out;
 }
 
 /// @brief Clear all the pixel from the screen.
@@ -600,24 +818,13 @@ void Screen::Clear() {
 
 // clang-format off
 void Screen::ApplyShader() {
-  // Merge box characters together
-  Pixel* data = pixels_.data() + 1;
-
-  for (int x = 1; x < dimx_; ++x) {
-     // Box drawing character uses exactly 3 byte.
-     if (!data->ShouldAttemptAutoMerge()) {
-        ++data;
-        continue;
-     }
-
-     Pixel* left = data - 1;
-     if (left->ShouldAttemptAutoMerge())
-        UpgradeLeftRight(*left, *data);
-
-     ++data;
-  }
+  // Merge box characters together. Only dirty rows can hold some.
+  for (int y = 0; y < dimy_; ++y) {
+    if (!IsDirty(y))
+      continue;
 
-  for (int y = 1; y < dimy_; ++y) {
+    Pixel* data = data_ + y * dimx_;
+    const bool top_dirty = y > 0 && IsDirty(y - 1);
     for (int x = 0; x < dimx_; ++x) {
       // Box drawing character uses exactly 3 byte.
       if (!data->ShouldAttemptAutoMerge()) {
@@ -631,9 +838,11 @@ void Screen::ApplyShader() {
           UpgradeLeftRight(*left, *data);
       }
 
-      Pixel* top = data - dimx_;
-      if (top->ShouldAttemptAutoMerge())
-         UpgradeTopDown(*top, *data);
+      if (top_dirty) {
+        Pixel* top = data - dimx_;
+        if (top->ShouldAttemptAutoMerge())
+           UpgradeTopDown(*top, *data);
+      }
 
       ++data;
     }
@@ -673,4 +882,67 @@ void Screen::SetSelectionStyle(SelectionStyle decorator) {
   selection_style_ = std::move(decorator);
 }
 
+/// @brief Create a screen drawing into the pixels of this one.
+/// @details The fork has its own graphemes pool, extending the one of this
+/// screen, its own hyperlinks and its own dirty rows. Several forks can
+/// therefore draw concurrently, as long as they draw into disjoint regions and
+/// this screen isn't modified until they are joined.
+/// @see Join
+Screen Screen::Fork() {
+  Screen fork(0, 0);
+  fork.stencil = stencil;
+  fork.dimx_ = dimx_;
+  fork.dimy_ = dimy_;
+  fork.data_ = data_;
+  fork.pool_ = PackedString::Pool(&pool_);
+  fork.dirty_rows_.assign(dimy_, 0);
+  fork.cursor_ = cursor_;
+  fork.hyperlinks_ = hyperlinks_;
+  fork.selection_style_ = selection_style_;
+  return fork;
+}
+
+/// @brief Bring back what |fork| drew into |box|.
+/// @details The graphemes and the hyperlinks registered by the fork are moved
+/// into this screen, and the pixels of |box| referring to them are updated.
+/// @see Fork
+void Screen::Join(const Screen& fork, Box box) {
+  box = Box::Intersection(box, Box{0, dimx_ - 1, 0, dimy_ - 1});
+  if (box.IsEmpty()) {
+    return;
+  }
+
+  // The pixels drawn before forking refer to offsets below this one.
+  const uint32_t pool_base = fork.pool_.base();
+  const bool new_graphemes = !fork.pool_.empty();
+
+  // The hyperlinks of the fork start with those of this screen, but this
+  // screen may have registered more since, from joining other forks.
+  std::array<uint8_t, 256> hyperlinks{};
+  bool new_hyperlinks = false;
+  for (size_t i = 0; i < fork.hyperlinks_.size(); ++i) {
+    hyperlinks[i] = RegisterHyperlink(fork.hyperlinks_[i]);
+    new_hyperlinks |= (hyperlinks[i] != i);
+  }
+
+  for (int y = box.y_min; y <= box.y_max; ++y) {
+    if (!fork.dirty_rows_[y]) {
+      continue;
+    }
+    dirty_rows_[y] = 1;
+    if (!new_graphemes && !new_hyperlinks) {
+      continue;
+    }
+
+    Pixel* pixel = data_ + y * dimx_ + box.x_min;
+    for (int x = box.x_min; x <= box.x_max; ++x, ++pixel) {
+      if (!pixel->grapheme.is_small() &&
+          pixel->grapheme.get_offset() >= pool_base) {
+        pixel->grapheme.copy(pixel->get_view(fork.pool_), pool_);
+      }
+      pixel->style.hyperlink = hyperlinks[pixel->style.hyperlink];
+    }
+  }
+}
+
 }  // namespace ftxui
@@ -0,0 +1,217 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <algorithm>  // for max
+#include <string>  // for allocator, string
+#include <string_view>  // for string_view
+
+#include "ftxui/screen/color.hpp"   // for Color, Color::Red
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+namespace ftxui {
+
+TEST(ScreenTest, ToStringCombinedStyle) {
+  Screen screen(4, 1);
+  screen.PixelAt(0, 0).grapheme = "a";
+  screen.PixelAt(0, 0).style.bold = true;
+  screen.PixelAt(0, 0).style.underlined = true;
+  screen.PixelAt(0, 0).style.foreground_color = Color::Red;
+  screen.PixelAt(1, 0).grapheme = "b";
+  screen.PixelAt(1, 0).style.bold = true;
+  screen.PixelAt(1, 0).style.foreground_color = Color::Red;
+  screen.PixelAt(2, 0).grapheme = "c";
+  screen.PixelAt(2, 0).style.dim = true;
+  screen.PixelAt(3, 0).grapheme = "d";
+  EXPECT_EQ(screen.ToString(),
+            "\x1B[1;4;31ma\x1B[24mb\x1B[22;2;39mc\x1B[0md");
+}
+
+TEST(ScreenTest, ToStringSingleAttribute) {
+  Screen screen(5, 1);
+  screen.PixelAt(0, 0).grapheme = "a";
+  screen.PixelAt(0, 0).style.bold = true;
+  screen.PixelAt(1, 0).grapheme = "b";
+  screen.PixelAt(1, 0).style.bold = true;
+  screen.PixelAt(1, 0).style.dim = true;
+  screen.PixelAt(2, 0).grapheme = "c";
+  screen.PixelAt(2, 0).style.dim = true;
+  screen.PixelAt(3, 0).grapheme = "d";
+  screen.PixelAt(3, 0).style.dim = true;
+  screen.PixelAt(3, 0).style.italic = true;
+  screen.PixelAt(4, 0).grapheme = "e";
+  screen.PixelAt(4, 0).style.italic = true;
+  EXPECT_EQ(screen.ToString(),
+            "\x1B[1ma\x1B[2mb\x1B[22;2mc\x1B[3md\x1B[22me\x1B[0m");
+}
+
+TEST(ScreenTest, ToStringIgnoresAutomerge) {
+  Screen screen(2, 1);
+  screen.PixelAt(0, 0).style.automerge = true;
+  EXPECT_EQ(screen.ToString(), "  ");
+}
+
+TEST(ScreenTest, ApplyShaderMerge) {
+  Screen screen(3, 2);
+  const char* glyphs[2][3] = {{"─", "│", "a"}, {"│", "━", "─"}};
+  for (int y = 0; y < 2; ++y) {
+    for (int x = 0; x < 3; ++x) {
+      screen.PixelAt(x, y).grapheme = std::string_view(glyphs[y][x]);
+      screen.PixelAt(x, y).style.automerge = true;
+    }
+  }
+  screen.ApplyShader();
+  EXPECT_EQ(screen.ToString(),
+            "┬┤a\r\n"
+            "┝┷─");
+}
+
+TEST(ScreenTest, ToStringDiffUnchanged) {
+  Screen previous(5, 2);
+  Screen screen(5, 2);
+  EXPECT_EQ(screen.ToStringDiff(previous), "\x1B[2;5H");
+}
+
+TEST(ScreenTest, ToStringDiffSingleCell) {
+  Screen previous(5, 2);
+  Screen screen(5, 2);
+  screen.PixelAt(2, 0).grapheme = "b";
+  EXPECT_EQ(screen.ToStringDiff(previous), "\x1B[1;3Hb\x1B[2;5H");
+}
+
+TEST(ScreenTest, ToStringDiffStyle) {
+  Screen previous(5, 2);
+  Screen screen(5, 2);
+  screen.PixelAt(1, 1).style.bold = true;
+  EXPECT_EQ(screen.ToStringDiff(previous),
+            "\x1B[2;2H\x1B[1m \x1B[0m\x1B[2;5H");
+}
+
+TEST(ScreenTest, ToStringDiffMergeCloseRuns) {
+  Screen previous(10, 1);
+  Screen screen(10, 1);
+  screen.PixelAt(1, 0).grapheme = "a";
+  screen.PixelAt(3, 0).grapheme = "b";
+  EXPECT_EQ(screen.ToStringDiff(previous), "\x1B[1;2Ha b\x1B[1;10H");
+}
+
+TEST(ScreenTest, ToStringDiffFullWidth) {
+  Screen previous(5, 1);
+  previous.PixelAt(1, 0).grapheme.copy("测", previous.get_pool());
+  previous.PixelAt(2, 0).grapheme = "";
+  Screen screen(5, 1);
+  screen.PixelAt(1, 0).grapheme.copy("测", screen.get_pool());
+  screen.PixelAt(2, 0).grapheme = "x";
+  EXPECT_EQ(screen.ToStringDiff(previous), "\x1B[1;2H测\x1B[1;5H");
+}
+
+TEST(ScreenTest, ToStringDiffResized) {
+  Screen previous(5, 2);
+  Screen screen(2, 1);
+  EXPECT_EQ(screen.ToStringDiff(previous), "\x1B[H" + screen.ToString());
+}
+
+TEST(ScreenTest, PackedStringEquality) {
+  Screen screen(4, 1);
+  screen.PixelAt(0, 0).grapheme = "ab";
+  screen.PixelAt(1, 0).grapheme = "ab";
+  screen.PixelAt(2, 0).grapheme = "ac";
+  screen.PixelAt(3, 0).grapheme = "a";
+  EXPECT_TRUE(screen.PixelAt(0, 0).grapheme == screen.PixelAt(1, 0).grapheme);
+  EXPECT_FALSE(screen.PixelAt(0, 0).grapheme == screen.PixelAt(2, 0).grapheme);
+  EXPECT_FALSE(screen.PixelAt(0, 0).grapheme == screen.PixelAt(3, 0).grapheme);
+}
+
+TEST(ScreenTest, PoolInternsGraphemes) {
+  Screen screen(4, 1);
+  screen.PixelAt(0, 0).grapheme.copy("👍🏻", screen.get_pool());
+  const size_t size = screen.get_pool().size();
+  screen.PixelAt(1, 0).grapheme.copy("👍🏻", screen.get_pool());
+  screen.PixelAt(2, 0).grapheme.copy("👍🏽", screen.get_pool());
+  EXPECT_EQ(screen.get_pool().size(), 2 * size);
+  EXPECT_EQ(screen.PixelAt(1, 0).get_view(screen.get_pool()), "👍🏻");
+  EXPECT_EQ(screen.PixelAt(2, 0).get_view(screen.get_pool()), "👍🏽");
+}
+
+TEST(ScreenTest, PoolStaysBounded) {
+  Screen screen(10, 2);
+  const std::string_view graphemes[] = {"👍🏻", "👍🏼", "👍🏽", "👍🏾", "👍🏿"};
+  size_t max_size = 0;
+  for (int frame = 0; frame < 1000; ++frame) {
+    for (int y = 0; y < 2; ++y) {
+      for (int x = 0; x < 10; ++x) {
+        // Mix recurring graphemes, and graphemes changing every frame.
+        const std::string grapheme =
+            (x + y) % 2 ? std::string(graphemes[(x + frame) % 5])
+                        : "é" + std::to_string(frame * 20 + y * 10 + x);
+        screen.PixelAt(x, y).grapheme.copy(grapheme, screen.get_pool());
+        EXPECT_EQ(screen.PixelAt(x, y).get_view(screen.get_pool()), grapheme);
+      }
+    }
+    max_size = std::max(max_size, screen.get_pool().size());
+    screen.Clear();
+  }
+
+  // Every grapheme holds in 3 words. The pool is reset when it exceeds the 20
+  // pixels, so it never holds more than one extra frame.
+  EXPECT_LE(max_size, 20u + 20u * 3u);
+}
+
+TEST(ScreenTest, ForkAndJoin) {
+  Screen screen(4, 2);
+  screen.PixelAt(0, 0).grapheme.copy("👍🏻", screen.get_pool());
+  screen.PixelAt(0, 0).style.hyperlink = screen.RegisterHyperlink("a");
+
+  // Two forks drawing on one row each.
+  Screen top = screen.Fork();
+  Screen bottom = screen.Fork();
+  EXPECT_EQ(top.PixelAt(0, 0).get_view(top.get_pool()), "👍🏻");
+  top.PixelAt(1, 0).grapheme.copy("👍🏽", top.get_pool());
+  top.PixelAt(1, 0).style.hyperlink = top.RegisterHyperlink("b");
+  bottom.PixelAt(0, 1).grapheme.copy("👍🏿", bottom.get_pool());
+  bottom.PixelAt(0, 1).style.hyperlink = bottom.RegisterHyperlink("c");
+  bottom.PixelAt(1, 1).grapheme.copy("👍🏻", bottom.get_pool());
+  EXPECT_TRUE(screen.get_pool().size() == top.get_pool().base());
+  EXPECT_FALSE(screen.IsDirty(1));
+
+  screen.Join(top, Box{0, 3, 0, 0});
+  screen.Join(bottom, Box{0, 3, 1, 1});
+  EXPECT_TRUE(screen.IsDirty(1));
+  EXPECT_EQ(screen.PixelAt(0, 0).get_view(screen.get_pool()), "👍🏻");
+  EXPECT_EQ(screen.PixelAt(1, 0).get_view(screen.get_pool()), "👍🏽");
+  EXPECT_EQ(screen.PixelAt(0, 1).get_view(screen.get_pool()), "👍🏿");
+  EXPECT_EQ(screen.PixelAt(1, 1).get_view(screen.get_pool()), "👍🏻");
+  EXPECT_EQ(screen.Hyperlink(screen.PixelAt(0, 0).style.hyperlink), "a");
+  EXPECT_EQ(screen.Hyperlink(screen.PixelAt(1, 0).style.hyperlink), "b");
+  EXPECT_EQ(screen.Hyperlink(screen.PixelAt(0, 1).style.hyperlink), "c");
+  EXPECT_EQ(screen.PixelAt(1, 1).style.hyperlink, 0);
+}
+
+TEST(ScreenTest, DirtyRows) {
+  Screen screen(3, 3);
+  EXPECT_FALSE(screen.IsDirty(0));
+  EXPECT_FALSE(screen.IsDirty(1));
+  EXPECT_FALSE(screen.IsDirty(2));
+
+  screen.PixelAt(1, 1).grapheme = "a";
+  screen.PixelAt(1, 1).style.bold = true;
+  EXPECT_FALSE(screen.IsDirty(0));
+  EXPECT_TRUE(screen.IsDirty(1));
+  EXPECT_FALSE(screen.IsDirty(2));
+  EXPECT_EQ(screen.ToString(), "   \r\n \x1B[1ma\x1B[0m \r\n   ");
+
+  screen.Clear();
+  EXPECT_FALSE(screen.IsDirty(1));
+  EXPECT_FALSE(screen.PixelAt(1, 1).style.bold);
+  EXPECT_EQ(screen.ToString(), "   \r\n   \r\n   ");
+}
+
+TEST(ScreenTest, ToStringDiffDirtyRows) {
+  Screen previous(5, 3);
+  previous.PixelAt(1, 0).grapheme = "a";
+  Screen screen(5, 3);
+  screen.PixelAt(1, 2).grapheme = "b";
+  EXPECT_EQ(screen.ToStringDiff(previous), "\x1B[1;2H \x1B[3;2Hb\x1B[3;5H");
+}
+
+}  // namespace ftxui
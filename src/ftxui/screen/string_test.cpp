@@ -3,11 +3,48 @@
 // the LICENSE file.
 #include "ftxui/screen/string.hpp"
 #include <gtest/gtest.h>
-#include <string>  // for allocator, string
-#include "ftxui/screen/string_internal.hpp"
+#include <cstdint>      // for uint32_t, uint8_t
+#include <string>       // for allocator, string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
 
 namespace ftxui {
 
+namespace {
+
+// Split |input| into its glyphs, one byte at a time, without any fast path.
+std::vector<std::string> ReferenceGlyphs(const std::string& input) {
+  std::vector<std::string> out;
+  size_t i = 0;
+  while (i < input.size()) {
+    const auto lead = static_cast<uint8_t>(input[i]);
+    const size_t size = lead < 0x80 ? 1 : lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : 4;
+    uint32_t ucs = size == 1 ? lead : lead & (0x7F >> size);
+    for (size_t j = 1; j < size; ++j) {
+      ucs = (ucs << 6) | (static_cast<uint8_t>(input[i + j]) & 0x3F);
+    }
+    const std::string glyph = input.substr(i, size);
+    i += size;
+
+    if (IsControl(ucs)) {
+      continue;
+    }
+    if (IsCombining(ucs)) {
+      if (!out.empty()) {
+        out.back() += glyph;
+      }
+      continue;
+    }
+    out.push_back(glyph);
+    if (IsFullWidth(ucs)) {
+      out.emplace_back();
+    }
+  }
+  return out;
+}
+
+}  // namespace
+
 TEST(StringTest, StringWidth) {
   // Basic:
   EXPECT_EQ(0, string_width(""));
@@ -48,6 +85,82 @@ TEST(StringTest, Utf8ToGlyphs) {
   EXPECT_EQ(Utf8ToGlyphs("a\1a"), T({"a", "a"}));
 }
 
+TEST(StringTest, Utf8ToGlyphSpans) {
+  // Compare against Utf8ToGlyphs.
+  for (const std::string input :
+       {"", "a", "ab", "测", "测试", "ā", "a⃒", "a̗", "\1", "a\1a", "a\n测b"}) {
+    bool complete = true;
+    std::vector<std::string> glyphs;
+    for (const GlyphSpan& span : Utf8ToGlyphSpans(input, &complete)) {
+      glyphs.emplace_back(span.In(input));
+    }
+    EXPECT_TRUE(complete) << input;
+    EXPECT_EQ(glyphs, Utf8ToGlyphs(input)) << input;
+  }
+
+  // A span can't skip over the control character separating a combining
+  // character from the glyph it modifies.
+  for (const std::string input : {"a\t\u0301", "x\r\uFE0F"}) {
+    bool complete = true;
+    std::vector<std::string> glyphs;
+    for (const GlyphSpan& span : Utf8ToGlyphSpans(input, &complete)) {
+      glyphs.emplace_back(span.In(input));
+    }
+    EXPECT_FALSE(complete) << input;
+    EXPECT_EQ(glyphs, std::vector<std::string>({input.substr(0, 1)}));
+    EXPECT_EQ(Utf8ToGlyphs(input), ReferenceGlyphs(input)) << input;
+  }
+  EXPECT_EQ(Utf8ToGlyphs("a\t\u0301"), std::vector<std::string>({"a\u0301"}));
+}
+
+TEST(StringTest, AsciiRun) {
+  // Put a non ASCII, or a control character, at every position of a string
+  // long enough to be scanned by blocks. Compare against a decoding without
+  // the ASCII fast path.
+  for (const std::string inserted :
+       {"测", "ā", "\u0301", "\x7F", "\1", "\n", "\t\u0301"}) {
+    for (size_t i = 0; i <= 40; ++i) {
+      const std::string input =
+          std::string(i, 'a') + inserted + std::string(40 - i, 'b');
+      const std::vector<std::string> glyphs = ReferenceGlyphs(input);
+
+      int glyph_count = 0;
+      for (const std::string& glyph : glyphs) {
+        glyph_count += glyph.empty() ? 0 : 1;
+      }
+
+      std::vector<std::string> spans;
+      for (const GlyphSpan& span : Utf8ToGlyphSpans(input)) {
+        spans.emplace_back(span.In(input));
+      }
+
+      EXPECT_EQ(Utf8ToGlyphs(input), glyphs) << i;
+      EXPECT_EQ(string_width(input), int(glyphs.size())) << i;
+      if (inserted != "\t\u0301") {
+        EXPECT_EQ(spans, glyphs) << i;
+      }
+
+      // Unlike Utf8ToGlyphs, these count a leading combining character as a
+      // glyph of its own.
+      const bool leading_combining = i == 0 && inserted.find("\u0301") !=
+                                                   std::string::npos;
+      if (!leading_combining) {
+        EXPECT_EQ(GlyphCount(input), glyph_count) << i;
+        EXPECT_EQ(CellToGlyphIndex(input).size(), glyphs.size()) << i;
+      }
+    }
+  }
+}
+
+TEST(StringTest, BmpWidthTable) {
+  for (uint32_t ucs = 0; ucs < 0x10000; ++ucs) {
+    EXPECT_EQ(IsCombining(ucs), Bisearch(ucs, g_extend_characters)) << ucs;
+    EXPECT_EQ(IsFullWidth(ucs),
+              ucs >= 0x300 && Bisearch(ucs, g_full_width_characters))
+        << ucs;
+  }
+}
+
 TEST(StringTest, GlyphCount) {
   // Basic:
   EXPECT_EQ(GlyphCount(""), 0);
@@ -129,17 +242,18 @@ TEST(StringTest, CellToGlyphIndex) {
 TEST(StringTest, Utf8ToWordBreakProperty) {
   using T = std::vector<WordBreakProperty>;
   using P = WordBreakProperty;
-  EXPECT_EQ(Utf8ToWordBreakProperty("a"), T({P::ALetter}));
-  EXPECT_EQ(Utf8ToWordBreakProperty("0"), T({P::Numeric}));
-  EXPECT_EQ(Utf8ToWordBreakProperty("א"), T({P::Hebrew_Letter}));
-  EXPECT_EQ(Utf8ToWordBreakProperty("ㇰ"), T({P::Katakana}));
-  EXPECT_EQ(Utf8ToWordBreakProperty(" "), T({P::WSegSpace}));
-  EXPECT_EQ(Utf8ToWordBreakProperty("\""), T({P::Double_Quote}));
-  EXPECT_EQ(Utf8ToWordBreakProperty("'"), T({P::Single_Quote}));
-  EXPECT_EQ(Utf8ToWordBreakProperty(":"), T({P::MidLetter}));
-  EXPECT_EQ(Utf8ToWordBreakProperty("."), T({P::MidNumLet}));
-  EXPECT_EQ(Utf8ToWordBreakProperty("\r"), T({}));  // FIXME
-  EXPECT_EQ(Utf8ToWordBreakProperty("\n"), T({P::LF}));
+  using V = std::string_view;
+  EXPECT_EQ(Utf8ToWordBreakProperty(V("a")), T({P::ALetter}));
+  EXPECT_EQ(Utf8ToWordBreakProperty(V("0")), T({P::Numeric}));
+  EXPECT_EQ(Utf8ToWordBreakProperty(V("א")), T({P::Hebrew_Letter}));
+  EXPECT_EQ(Utf8ToWordBreakProperty(V("ㇰ")), T({P::Katakana}));
+  EXPECT_EQ(Utf8ToWordBreakProperty(V(" ")), T({P::WSegSpace}));
+  EXPECT_EQ(Utf8ToWordBreakProperty(V("\"")), T({P::Double_Quote}));
+  EXPECT_EQ(Utf8ToWordBreakProperty(V("'")), T({P::Single_Quote}));
+  EXPECT_EQ(Utf8ToWordBreakProperty(V(":")), T({P::MidLetter}));
+  EXPECT_EQ(Utf8ToWordBreakProperty(V(".")), T({P::MidNumLet}));
+  EXPECT_EQ(Utf8ToWordBreakProperty(V("\r")), T({}));  // FIXME
+  EXPECT_EQ(Utf8ToWordBreakProperty(V("\n")), T({P::LF}));
 }
 
 TEST(StringTest, to_string) {
@@ -154,14 +268,14 @@ TEST(StringTest, to_string) {
 }
 
 TEST(StringTest, to_wstring) {
-  EXPECT_EQ(to_wstring(std::string("hello")), L"hello");
-  EXPECT_EQ(to_wstring(std::string("€")), L"€");
-  EXPECT_EQ(to_wstring(std::string("ÿ")), L"ÿ");
-  EXPECT_EQ(to_wstring(std::string("߿")), L"߿");
-  EXPECT_EQ(to_wstring(std::string("ɰɱ")), L"ɰɱ");
-  EXPECT_EQ(to_wstring(std::string("«»")), L"«»");
-  EXPECT_EQ(to_wstring(std::string("嵰嵲嵫")), L"嵰嵲嵫");
-  EXPECT_EQ(to_wstring(std::string("🎅🎄")), L"🎅🎄");
+  EXPECT_EQ(to_wstring(std::string_view("hello")), L"hello");
+  EXPECT_EQ(to_wstring(std::string_view("€")), L"€");
+  EXPECT_EQ(to_wstring(std::string_view("ÿ")), L"ÿ");
+  EXPECT_EQ(to_wstring(std::string_view("߿")), L"߿");
+  EXPECT_EQ(to_wstring(std::string_view("ɰɱ")), L"ɰɱ");
+  EXPECT_EQ(to_wstring(std::string_view("«»")), L"«»");
+  EXPECT_EQ(to_wstring(std::string_view("嵰嵲嵫")), L"嵰嵲嵫");
+  EXPECT_EQ(to_wstring(std::string_view("🎅🎄")), L"🎅🎄");
 }
 
 }  // namespace ftxui
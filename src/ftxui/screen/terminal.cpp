@@ -26,6 +26,12 @@ namespace {
 bool g_cached = false;                     // NOLINT
 Terminal::Color g_cached_supported_color;  // NOLINT
 
+// The size of the terminal is only cached while a SIGWINCH handler refreshes
+// it. See Terminal::CacheSize().
+bool g_size_cache_enabled = false;  // NOLINT
+bool g_size_cached = false;         // NOLINT
+Dimensions g_cached_size;           // NOLINT
+
 Dimensions& FallbackSize() {
 #if defined(__EMSCRIPTEN__)
   // This dimension was chosen arbitrarily to be able to display:
@@ -84,14 +90,7 @@ Terminal::Color ComputeColorSupport() {
   return Terminal::Color::Palette16;
 }
 
-}  // namespace
-
-namespace Terminal {
-
-/// @brief Get the terminal size.
-/// @return The terminal size.
-/// @ingroup screen
-Dimensions Size() {
+Dimensions QuerySize() {
 #if defined(__EMSCRIPTEN__)
   // This dimension was chosen arbitrarily to be able to display:
   // https://arthursonzogni.com/FTXUI/examples
@@ -119,10 +118,57 @@ Dimensions Size() {
 #endif
 }
 
+}  // namespace
+
+namespace Terminal {
+
+/// @brief Get the terminal size.
+/// @return The terminal size.
+/// @note While the size is cached, see CacheSize(), this doesn't query the
+/// terminal.
+/// @ingroup screen
+Dimensions Size() {
+  if (!g_size_cache_enabled) {
+    return QuerySize();
+  }
+  if (!g_size_cached) {
+    g_size_cached = true;
+    g_cached_size = QuerySize();
+  }
+  return g_cached_size;
+}
+
+/// @brief Query the size of the terminal again, updating the cached one.
+/// @return The terminal size.
+/// @ingroup screen
+Dimensions RefreshSize() {
+  g_size_cached = true;
+  g_cached_size = QuerySize();
+  return g_cached_size;
+}
+
+/// @brief Let Size() reuse the last size queried, instead of querying the
+/// terminal every time.
+///
+/// This must only be enabled while the caller calls RefreshSize() whenever
+/// the terminal is resized, as ScreenInteractive does on SIGWINCH.
+/// @ingroup screen
+void CacheSize(bool enabled) {
+  g_size_cache_enabled = enabled;
+  g_size_cached = false;
+}
+
+/// @brief Whether Size() reuses the last size queried. See CacheSize().
+/// @ingroup screen
+bool SizeCached() {
+  return g_size_cache_enabled;
+}
+
 /// @brief Override terminal size in case auto-detection fails
 /// @param fallbackSize Terminal dimensions to fallback to
 void SetFallbackSize(const Dimensions& fallbackSize) {
   FallbackSize() = fallbackSize;
+  g_size_cached = false;
 }
 
 /// @brief Get the color support of the terminal.
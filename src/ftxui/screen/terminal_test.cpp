@@ -0,0 +1,53 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+
+#include "ftxui/screen/terminal.hpp"  // for Size, RefreshSize, CacheSize, SizeCached
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+// The tests don't run in a terminal: its size is the fallback one.
+class TerminalTest : public testing::Test {
+ protected:
+  void TearDown() override {
+    Terminal::CacheSize(false);
+    Terminal::SetFallbackSize({80, 24});
+  }
+};
+
+}  // namespace
+
+TEST_F(TerminalTest, Uncached) {
+  EXPECT_FALSE(Terminal::SizeCached());
+  Terminal::SetFallbackSize({12, 3});
+  EXPECT_EQ(Terminal::Size().dimx, 12);
+  EXPECT_EQ(Terminal::Size().dimy, 3);
+}
+
+TEST_F(TerminalTest, Cached) {
+  Terminal::SetFallbackSize({12, 3});
+  Terminal::CacheSize(true);
+  EXPECT_TRUE(Terminal::SizeCached());
+  EXPECT_EQ(Terminal::Size().dimx, 12);
+
+  // Overriding the fallback size is seen by the next query.
+  Terminal::SetFallbackSize({20, 5});
+  EXPECT_EQ(Terminal::Size().dimx, 20);
+  EXPECT_EQ(Terminal::Size().dimy, 5);
+
+  Dimensions size = Terminal::RefreshSize();
+  EXPECT_EQ(size.dimx, 20);
+  EXPECT_EQ(size.dimy, 5);
+
+  Terminal::CacheSize(false);
+  EXPECT_FALSE(Terminal::SizeCached());
+  Terminal::SetFallbackSize({7, 2});
+  EXPECT_EQ(Terminal::Size().dimx, 7);
+}
+
+}  // namespace ftxui
+// NOLINTEND